@@ -12,6 +12,8 @@
  */
 
 #include <HDC2022.hpp>
+#include <I2CBus.hpp>
+#include <Trace.hpp>
 
 /*
  * Example Usage
@@ -23,47 +25,269 @@
  *	HDC2022_c HDC2022;
  * 	void main()
  * 	{
- * 	 HDC2022.Init(hi2c1,100);
+ * 	 if(HDC2022.Init(hi2c1,100) != HDC2022_c::RESULT_OK) { ... no HDC2022 at 0x40 / 0x41 }
  * 		while(1)
  * 		{
  *			temperature=HDC2022.get_Temperature();
  *			humidityHDC2022.get_Humidity();
  * 		}
  * 	}
+ *
+ *	Several sensors on several buses :
+ *
+ *	HDC2022_c sensors[4];
+ *	I2C_HandleTypeDef *const buses[2] = { &hi2c1, &hi2c2 };
+ *	uint8_t found = HDC2022_c::probe_Array(sensors, 4, buses, 2, 10);
  */
 
+#if UINTPTR_MAX == 0xFFFFFFFFUL
+static_assert(sizeof(HDC2022_c) == 56, "HDC2022_c layout grew, update the RAM budget in HDC2022.hpp");
+#endif
+
+#define I2C_RECOVERY_CLOCKS     9       /*  SCL pulses to release a slave stuck in a read   */
+#define I2C_RECOVERY_HALF_US    5       /*  Half SCL period during recovery (100 kHz)       */
+
+/**
+ * @brief  Busy Wait In Microseconds
+ * @note   Uses the DWT cycle counter enabled in Init(), independent of SysTick
+ * @param  uint32_t us	:	Delay
+ * @retval None
+ */
+static void delay_us(uint32_t us)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = us * (SystemCoreClock / 1000000U);
+
+    while ((DWT->CYCCNT - start) < cycles)
+    {
+    }
+}
+
+/**
+ * @brief  I2C Bus Recovery
+ * @note   De-initializes the peripheral, clocks SCL until a stuck slave releases SDA, issues a STOP
+ * 		and re-initializes the peripheral. SCL clocking is skipped when set_RecoveryPins() was not called.
+ * 		Bounded : 9 clocks * 10 us + STOP, well below 0.2 ms plus HAL_I2C_Init()
+ * @param  None
+ * @retval None
+ */
+void HDC2022_c::I2C_recover()
+{
+
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    i2c_stats.recoveries++;
+    if (bus != NULL)
+    {
+        bus->hold(i2c_timeout);
+    }
+    HAL_I2C_DeInit(i2c);
+
+    if ((scl_port != NULL) && (sda_port != NULL))
+    {
+        GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_OD;
+        GPIO_InitStruct.Pull = GPIO_PULLUP;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+        GPIO_InitStruct.Pin = scl_pin;
+        HAL_GPIO_WritePin(scl_port, scl_pin, GPIO_PIN_SET);
+        HAL_GPIO_Init(scl_port, &GPIO_InitStruct);
+        GPIO_InitStruct.Pin = sda_pin;
+        HAL_GPIO_WritePin(sda_port, sda_pin, GPIO_PIN_SET);
+        HAL_GPIO_Init(sda_port, &GPIO_InitStruct);
+
+        for (uint8_t i = 0; (i < I2C_RECOVERY_CLOCKS) && (HAL_GPIO_ReadPin(sda_port, sda_pin) == GPIO_PIN_RESET); i++)
+        {
+            HAL_GPIO_WritePin(scl_port, scl_pin, GPIO_PIN_RESET);
+            delay_us(I2C_RECOVERY_HALF_US);
+            HAL_GPIO_WritePin(scl_port, scl_pin, GPIO_PIN_SET);
+            delay_us(I2C_RECOVERY_HALF_US);
+        }
+
+        /*  STOP condition : SDA rises while SCL is high  */
+        HAL_GPIO_WritePin(scl_port, scl_pin, GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(sda_port, sda_pin, GPIO_PIN_RESET);
+        delay_us(I2C_RECOVERY_HALF_US);
+        HAL_GPIO_WritePin(scl_port, scl_pin, GPIO_PIN_SET);
+        delay_us(I2C_RECOVERY_HALF_US);
+        HAL_GPIO_WritePin(sda_port, sda_pin, GPIO_PIN_SET);
+        delay_us(I2C_RECOVERY_HALF_US);
+    }
+
+    HAL_I2C_Init(i2c);
+    if (bus != NULL)
+    {
+        bus->release();
+    }
+
+}
+
+/**
+ * @brief  Shared Bus Transfer
+ * @note   One attempt queued on the attached I2CBus_c, waits up to i2c_timeout for queueing plus transfer.
+ * 		Classified from the descriptor : HAL_I2C_GetError() already belongs to the next queued transfer
+ * @param  addr_t reg 	: Address Register
+ * @param  uint8_t *buf	: Data to send or receive
+ * @param  uint16_t len	: Number of bytes
+ * @param  uint8_t write	: 1 = write, 0 = read
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::bus_transfer(addr_t reg, uint8_t *buf, uint16_t len, uint8_t write)
+{
+
+    i2c_txn_t txn = {};
+
+    txn.address = DeviceID;
+    txn.reg = reg;
+    txn.write = write;
+    txn.priority = bus_priority;
+    txn.buf = buf;
+    txn.len = len;
+
+    switch (bus->transfer(&txn, i2c_timeout))
+    {
+        case I2C_BUS_OK:
+            return RESULT_OK;
+        case I2C_BUS_NACK:
+            return RESULT_NACK;
+        case I2C_BUS_ERROR:
+            return RESULT_BUS_ERROR;
+        case I2C_BUS_TIMEOUT:
+            return RESULT_TIMEOUT;
+        default:
+            return RESULT_BUSY;
+    }
+
+}
+
+/**
+ * @brief  General I2C Bus Transfer Function With Retry
+ * @note   Register access as one combined transaction (repeated start on read).
+ * 		NACK is retried as is (device may be converting), timeout/busy/bus error run I2C_recover() first.
+ * 		Worst case latency : (retries + 1) * (max(i2c_timeout, 25 ms) + 1 tick) + retries * recovery,
+ * 		the HAL waits up to I2C_TIMEOUT_BUSY (25 ms) for a free bus before each attempt whatever i2c_timeout
+ * 		is, so a stuck SDA costs that on every attempt. See get_Statistics(), Tools/I2CFaultSim
+ * @param  addr_t reg 	: Address Register, must be addr_t type on the header file
+ * @param  uint8_t *buf	: Data to send or receive
+ * @param  uint16_t len	: Number of bytes
+ * @param  uint8_t write	: 1 = write, 0 = read
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::I2C_transfer(addr_t reg, uint8_t *buf, uint16_t len, uint8_t write)
+{
+
+    uint32_t start = DWT->CYCCNT;
+    uint32_t elapsed;
+    HAL_StatusTypeDef status;
+
+    TRACE(TRACE_I2C_START, ((uint32_t)write << 16) | ((uint32_t)reg << 8) | (len & 0xFF));
+    for (uint8_t attempt = 0; attempt <= i2c_retries; attempt++)
+    {
+        if (attempt != 0)
+        {
+            i2c_stats.retries++;
+        }
+
+        if (bus != NULL)
+        {
+            i2c_result = bus_transfer(reg, buf, len, write);
+        }
+        else
+        {
+            if (write)
+            {
+                status = HAL_I2C_Mem_Write(i2c, DeviceID, reg, I2C_MEMADD_SIZE_8BIT, buf, len, i2c_timeout);
+            }
+            else
+            {
+                status = HAL_I2C_Mem_Read(i2c, DeviceID, reg, I2C_MEMADD_SIZE_8BIT, buf, len, i2c_timeout);
+            }
+
+            /*  Blocking HAL call, nothing else ran on the handle since : its ErrorCode is this transfer's  */
+            if (status == HAL_OK)
+            {
+                i2c_result = RESULT_OK;
+            }
+            else if (status == HAL_BUSY)
+            {
+                i2c_result = RESULT_BUSY;
+            }
+            else if (HAL_I2C_GetError(i2c) & (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_ARLO))
+            {
+                i2c_result = RESULT_BUS_ERROR;
+            }
+            else if (HAL_I2C_GetError(i2c) & HAL_I2C_ERROR_AF)
+            {
+                i2c_result = RESULT_NACK;
+            }
+            else
+            {
+                i2c_result = RESULT_TIMEOUT;
+            }
+        }
+
+        if (i2c_result == RESULT_OK)
+        {
+            break;
+        }
+        if (i2c_result == RESULT_NACK)
+        {
+            continue;
+        }
+
+        if (attempt < i2c_retries)
+        {
+            I2C_recover();
+        }
+    }
+
+    i2c_stats.transfers++;
+    if (i2c_result != RESULT_OK)
+    {
+        i2c_stats.failures++;
+    }
+    elapsed = DWT->CYCCNT - start;
+    if (elapsed > i2c_stats.worst_cycles)
+    {
+        i2c_stats.worst_cycles = elapsed;
+    }
+    TRACE(TRACE_I2C_END, i2c_result);
+
+    return (result_t)i2c_result;
+
+}
+
 /**
  * @brief  General I2C Bus Transmit Function
  * @note   Handler and timeout must be set in the Init() function, otherwise system return error
+ * 		Outcome is available from get_LastResult()
  * @param  addr_t reg 	: Address Register, must be addr_t type on the header file
  * @param  uint8_t val	: Value of Address Register to send Slave
  * @retval None
  */
 void HDC2022_c::I2C_setByte(addr_t reg, uint8_t val)
 {
-    uint8_t buf_setI2C[2];
 
-    buf_setI2C[0] = reg;
-    buf_setI2C[0] = val;
-    HAL_I2C_Master_Transmit(&i2c, DeviceID, buf_setI2C, 2, i2c_timeout);
+    I2C_transfer(reg, &val, 1, 1);
 
 }
 
 /**
  * @brief  General I2C Bus Transmit&Receive Function
  * @note   Handler and timeout must be set in the Init() function, otherwise system return error
+ * 		Returns 0x00 on failure, check get_LastResult()
  * @param  addr_t reg 	: Address Register, must be addr_t type on the header file
  * @retval uint8_t 	: Value of requested address
  */
 uint8_t HDC2022_c::I2C_getByte(addr_t reg)
 {
 
-    uint8_t buf_getI2C[2];
+    uint8_t val = 0x00;
 
-    buf_getI2C[0] = reg;
-    HAL_I2C_Master_Transmit(&i2c, DeviceID, buf_getI2C, 1, i2c_timeout);
-    HAL_I2C_Master_Receive(&i2c, DeviceID, buf_getI2C, 1, i2c_timeout);
-    return buf_getI2C[0];
+    if (I2C_transfer(reg, &val, 1, 0) != RESULT_OK)
+    {
+        return 0x00;
+    }
+    return val;
 
 }
 
@@ -76,13 +300,6 @@ uint8_t HDC2022_c::I2C_getByte(addr_t reg)
 void HDC2022_c::DeInit()
 {
 
-    TEMPERATURE_LOW = 0x00;
-    TEMPERATURE_HIGH = 0x00;
-    HUMIDITY_LOW = 0x00;
-    HUMIDITY_HIGH = 0x00;
-    STATUS.val = 0x00;
-    TEMPERATURE_MAX = 0x00;
-    HUMIDITY_MAX = 0x00;
     INTERRUPT_ENABLE.val = 0x00;
     TEMPERATURE_OFFSET_ADJUSTMENT.val = 0x00;
     HUMIDITY_OFFSET_ADJUSTMENT.val = 0x00;
@@ -92,68 +309,391 @@ void HDC2022_c::DeInit()
     HUMIDITY_THRESHOLD_HIGH = 0xFF;
     DEVICE_CONFIGURATION.val = 0x00;
     MEASUREMENT_CONFIGURATION.val = 0x00;
-    MANUFACTURER_ID_LOW = 0x49;
-    MANUFACTURER_ID_HIGH = 0x54;
-    DEVICE_ID_LOW = 0xD0;
-    DEVICE_ID_HIGH = 0X07;
 }
 
 /**
  * @brief  Sensor Initialization Function
- * @note   Use in the main function, before the while(1)
- * 		Check Device address is correct
- * @param  I2C_HandleTypeDef I2C_Handler	:	I2C bus handler
+ * @note   Use in the main function, before the while(1) and before attach_Bus()
+ * 		Finds the sensor at 0x40 or 0x41 and checks its IDs, see probe(). The configuration is
+ * 		only written to a verified device, a missing sensor costs two address probes, not a failing burst
+ * 		The handle is kept by reference, it must outlive the driver (a global CubeMX handle does)
+ * @param  I2C_HandleTypeDef &I2C_Handler	:	I2C bus handler
  * @param	uint8_t timeout					:	I2C bus timeout
+ * @retval result_t						:	RESULT_OK = sensor found and configured
+ */
+HDC2022_c::result_t HDC2022_c::Init(I2C_HandleTypeDef &I2C_Handler, uint8_t timeout)
+{
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    DeInit();
+
+    if (probe(I2C_Handler, timeout) == RESULT_OK)
+    {
+        configure();
+    }
+
+    return (result_t)i2c_result;
+
+}
+
+/**
+ * @brief  Write Configuration
+ * @note   All writable registers from their shadows, INTERRUPT_ENABLE .. MEASUREMENT_CONFIGURATION
+ * 		are contiguous and written in one burst
+ * @param  None
+ * @retval None
+ */
+void HDC2022_c::configure()
+{
+
+    uint8_t configuration[ConfigurationSize];
+
+    get_Configuration(configuration);
+    I2C_transfer(ADDR_INTERRUPT_ENABLE, configuration, ConfigurationSize, 1);
+
+}
+
+/**
+ * @brief  Get Configuration
+ * @note   The shadows in register order from 0x07, as written by configure() and HDC2022Async_c::restart().
+ * 		SOFT_RES and MEAS_TRIG are left out
+ * @param  uint8_t *configuration	:	ConfigurationSize bytes
  * @retval None
  */
-void HDC2022_c::Init(I2C_HandleTypeDef I2C_Handler, uint8_t timeout)
+void HDC2022_c::get_Configuration(uint8_t *configuration)
+{
+
+    configuration[0] = INTERRUPT_ENABLE.val;
+    configuration[1] = TEMPERATURE_OFFSET_ADJUSTMENT.val;
+    configuration[2] = HUMIDITY_OFFSET_ADJUSTMENT.val;
+    configuration[3] = TEMPERATURE_THRESHOLD_LOW;
+    configuration[4] = TEMPERATURE_THRESHOLD_HIGH;
+    configuration[5] = HUMIDITY_THRESHOLD_LOW;
+    configuration[6] = HUMIDITY_THRESHOLD_HIGH;
+    configuration[7] = HDC2022Map::DEVICE_CONFIGURATION::SOFT_RES::set(DEVICE_CONFIGURATION.val, 0);
+    configuration[8] = HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(MEASUREMENT_CONFIGURATION.val, 0);
+
+}
+
+/**
+ * @brief  Soft Reset And Restore
+ * @note   Sets SOFT_RES, polls DEVICE_CONFIGURATION until SOFT_RES reads back cleared (NACKs while the
+ * 		device resets count as not yet), then restores the shadows with configure() : 3 transactions
+ * 		plus the polls instead of Init()'s probe and writes. Auto mode restarts with the restored
+ * 		MEASUREMENT_CONFIGURATION, call trigger_Measurement() to resume a one-shot sequence
+ * @param  uint32_t timeout_ms	:	Deadline for the self-clear, HAL_GetTick() based
+ * @retval result_t			:	Error of the SOFT_RES write (no reset was started, nothing is polled),
+ * 								RESULT_TIMEOUT when SOFT_RES did not clear in time
+ */
+HDC2022_c::result_t HDC2022_c::soft_Reset(uint32_t timeout_ms)
+{
+
+    uint32_t start = HAL_GetTick();
+    uint8_t value;
+
+    I2C_setByte(ADDR_DEVICE_CONFIGURATION, HDC2022Map::DEVICE_CONFIGURATION::SOFT_RES::mask);
+    if (i2c_result != RESULT_OK)
+    {
+        return (result_t)i2c_result;
+    }
+
+    do
+    {
+        if ((I2C_transfer(ADDR_DEVICE_CONFIGURATION, &value, 1, 0) == RESULT_OK)
+            && !HDC2022Map::DEVICE_CONFIGURATION::SOFT_RES::get(value))
+        {
+            configure();
+            return (result_t)i2c_result;
+        }
+    } while ((HAL_GetTick() - start) < timeout_ms);
+
+    i2c_result = RESULT_TIMEOUT;
+    return RESULT_TIMEOUT;
+
+}
+
+/**
+ * @brief  Identify Device
+ * @note   One address-only probe (HAL_I2C_IsDeviceReady, single trial), then the IDs in one burst.
+ * 		Binds the handle and address on success, blocking HAL calls, not through the I2CBus_c
+ * @param  I2C_HandleTypeDef *handle
+ * @param  uint8_t address			:	8 bit address
+ * @param  uint8_t timeout			:	I2C bus timeout
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::identify(I2C_HandleTypeDef *handle, uint8_t address, uint8_t timeout)
 {
 
-    i2c = I2C_Handler;
+    uint16_t manufacturer;
+    uint16_t device;
+    result_t result;
+
+    if (HAL_I2C_IsDeviceReady(handle, address, 1, timeout) != HAL_OK)
+    {
+        i2c_result = RESULT_NACK;
+        return RESULT_NACK;
+    }
+
+    i2c = handle;
     i2c_timeout = timeout;
-    DeviceID = DeviceIDLow;
-    DeInit();
-    set_DeviceConfiguration();
-    set_HumidityHIGHThreshold();
-    set_HumidityOffset();
-    set_HumidityLOWThreshold();
-    set_Interrupt();
-    set_TemperatureOffset();
-    set_TemperatureLOWThreshold();
-    set_TemperatureHIGHThreshold();
-    set_MeasurementConfiguration();
+    DeviceID = address;
+    result = read_ID(manufacturer, device);
+    if ((result == RESULT_OK) && ((manufacturer != ManufacturerID) || (device != DeviceIDValue)))
+    {
+        result = RESULT_WRONG_DEVICE;
+    }
+
+    i2c_result = result;
+    return result;
+
+}
+
+/**
+ * @brief  Probe Sensor
+ * @note   Tries 0x40 (ADDR pin low) then 0x41 on this bus and keeps the first HDC2022 found.
+ * 		Without one the address stays 0x40 and the last failure is returned
+ * @param  I2C_HandleTypeDef &I2C_Handler	:	I2C bus handler
+ * @param	uint8_t timeout					:	I2C bus timeout
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::probe(I2C_HandleTypeDef &I2C_Handler, uint8_t timeout)
+{
+
+    result_t result = identify(&I2C_Handler, DeviceIDLow, timeout);
+
+    if (result != RESULT_OK)
+    {
+        result = identify(&I2C_Handler, DeviceIDHigh, timeout);
+    }
+    if (result != RESULT_OK)
+    {
+        i2c = &I2C_Handler;
+        i2c_timeout = timeout;
+        DeviceID = DeviceIDLow;
+    }
+
+    return result;
+
+}
+
+/**
+ * @brief  Probe Sensor Array
+ * @note   Every bus, both addresses, in that order : each HDC2022 found is bound to the next object
+ * 		and configured from its shadows. Each missing candidate costs one address byte, a ready sensor
+ * 		one address probe and one 4 byte ID burst plus its configuration. Enables the DWT cycle counter
+ * 		like Init(), delay_us() and the transfer timing depend on it
+ * @param  HDC2022_c *sensors					:	count objects, DeInit() state or configured shadows
+ * @param  uint8_t count
+ * @param  I2C_HandleTypeDef *const *buses	:	Initialized handles
+ * @param  uint8_t bus_count
+ * @param  uint8_t timeout					:	I2C bus timeout
+ * @retval uint8_t							:	Sensors found, sensors[0 .. n-1] are ready
+ */
+uint8_t HDC2022_c::probe_Array(HDC2022_c *sensors, uint8_t count, I2C_HandleTypeDef *const *buses, uint8_t bus_count, uint8_t timeout)
+{
+
+    static const uint8_t addresses[2] = { DeviceIDLow, DeviceIDHigh };
+    uint8_t found = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t b = 0; b < bus_count; b++)
+    {
+        for (uint8_t a = 0; (a < 2) && (found < count); a++)
+        {
+            if (sensors[found].identify(buses[b], addresses[a], timeout) == RESULT_OK)
+            {
+                sensors[found++].configure();
+            }
+        }
+    }
+
+    return found;
+
+}
+
+/**
+ * @brief  Read Identification
+ * @note   MANUFACTURER_ID_LOW .. DEVICE_ID_HIGH in one 4 byte burst, 0x5449 / 0x07D0 for an HDC2022
+ * @param  uint16_t &manufacturer	:	Left unchanged on error
+ * @param  uint16_t &device		:	Left unchanged on error
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::read_ID(uint16_t &manufacturer, uint16_t &device)
+{
+
+    uint8_t data[4];
+    result_t result = I2C_transfer(ADDR_MANUFACTURER_ID_LOW, data, 4, 0);
+
+    if (result == RESULT_OK)
+    {
+        manufacturer = (uint16_t)((data[1] << 8) | data[0]);
+        device = (uint16_t)((data[3] << 8) | data[2]);
+    }
+
+    return result;
+
+}
+
+/**
+ * @brief  Get Device Address
+ * @note   8 bit address found by probe(), 0x40<<1 before
+ * @param  None
+ * @retval uint8_t
+ */
+uint8_t HDC2022_c::get_Address()
+{
+
+    return DeviceID;
 
 }
 
 /**
  * @brief  Get Temperature Values
  * @note   read sensor values as byte as and calculate temperature value as a Celsius (°C)
+ * 		T = (code / 2^16) * 165 - 40. Keep get_TemperatureRaw() when the value is only stored or sent
  * @param  None
  * @retval float
  */
 float HDC2022_c::get_Temperature()
 {
 
-    buffer_8[0] = I2C_getByte(ADDR_TEMPERATURE_LOW);
-    buffer_8[1] = I2C_getByte(ADDR_TEMPERATURE_HIGH);
-
+    return decode_Temperature(get_TemperatureRaw());
 
-    return ((buffer_8[1] << 8) | (buffer_8[0])) * 1.2589 - 40;
 }
 
 /**
  * @brief  Get Humidity Values
  * @note   read sensor values as byte as and calculate humidity value as a  Relative Humidity (RH)
+ * 		RH = (code / 2^16) * 100. Keep get_HumidityRaw() when the value is only stored or sent
  * @param  None
  * @retval float
  */
 float HDC2022_c::get_Humidity()
 {
 
-    buffer_8[0] = I2C_getByte(ADDR_HUMIDITY_LOW);
-    buffer_8[1] = I2C_getByte(ADDR_HUMIDITY_HIGH);
+    return decode_Humidity(get_HumidityRaw());
+
+}
+
+/**
+ * @brief  Get Raw Temperature Code
+ * @note   Both bytes in one burst, so they belong to the same conversion. 0 on bus error
+ * @param  None
+ * @retval uint16_t	:	TEMPERATURE_HIGH:TEMPERATURE_LOW
+ */
+uint16_t HDC2022_c::get_TemperatureRaw()
+{
+
+    uint8_t data[2];
+
+    if (I2C_transfer(ADDR_TEMPERATURE_LOW, data, 2, 0) != RESULT_OK)
+    {
+        return 0;
+    }
+
+    return (uint16_t)((data[1] << 8) | data[0]);
+
+}
+
+/**
+ * @brief  Get Raw Humidity Code
+ * @note   Both bytes in one burst, so they belong to the same conversion. 0 on bus error
+ * @param  None
+ * @retval uint16_t	:	HUMIDITY_HIGH:HUMIDITY_LOW
+ */
+uint16_t HDC2022_c::get_HumidityRaw()
+{
+
+    uint8_t data[2];
+
+    if (I2C_transfer(ADDR_HUMIDITY_LOW, data, 2, 0) != RESULT_OK)
+    {
+        return 0;
+    }
+
+    return (uint16_t)((data[1] << 8) | data[0]);
+
+}
+
+/**
+ * @brief  Get Raw Sample
+ * @note   Temperature and humidity codes in one 4 byte burst, integer only
+ * @param  raw_sample_t &sample	:	Left unchanged on error
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::get_Sample(raw_sample_t &sample)
+{
+
+    uint8_t data[4];
+    result_t result = I2C_transfer(ADDR_TEMPERATURE_LOW, data, 4, 0);
+
+    if (result == RESULT_OK)
+    {
+        sample.temperature = (uint16_t)((data[1] << 8) | data[0]);
+        sample.humidity = (uint16_t)((data[3] << 8) | data[2]);
+    }
+
+    return result;
+
+}
+
+/**
+ * @brief  Get Sample And Peaks
+ * @note	One 7 byte burst TEMPERATURE_LOW .. HUMIDITY_MAX : the latest conversion, STATUS and the maxima
+ * 		the device kept since power-up or the last reset_Peaks(). Reading STATUS clears DRDY and the
+ * 		latched threshold bits. The maxima are only updated in one-shot mode
+ * @param  peak_sample_t &peaks	:	Left unchanged on error
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::get_Peaks(peak_sample_t &peaks)
+{
+
+    uint8_t data[7];
+    result_t result = I2C_transfer(ADDR_TEMPERATURE_LOW, data, 7, 0);
+
+    if (result == RESULT_OK)
+    {
+        peaks.last.temperature = (uint16_t)((data[1] << 8) | data[0]);
+        peaks.last.humidity = (uint16_t)((data[3] << 8) | data[2]);
+        peaks.status = data[4];
+        peaks.temperature_max = data[5];
+        peaks.humidity_max = data[6];
+    }
+
+    return result;
+
+}
+
+/**
+ * @brief  Reset Peaks
+ * @note	The maxima have no clear bit, a soft reset clears them. soft_Reset() restores the configuration
+ * 		afterwards, the next conversion starts a new peak window
+ * @param  uint32_t timeout_ms	:	Deadline for the self-clear, HAL_GetTick() based
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::reset_Peaks(uint32_t timeout_ms)
+{
+
+    return soft_Reset(timeout_ms);
 
-    return ((buffer_8[1] << 8) | (buffer_8[0])) * 0.763;
+}
+
+/**
+ * @brief  Get Peak Alarm
+ * @note	Compares the maxima with the HIGH threshold shadows, both are 8 bit codes on the same scale.
+ * 		No bus access : a peak above a threshold is seen at the next get_Peaks() even when it fell back
+ * 		between reads. Minima are not kept by the device, LOW thresholds are not checked
+ * @param  const peak_sample_t &peaks
+ * @retval uint8_t	:	TH_STATUS / HH_STATUS bits of the STATUS layout, 0 = no alarm
+ */
+uint8_t HDC2022_c::get_PeakAlarm(const peak_sample_t &peaks)
+{
+
+    return HDC2022Map::STATUS::TH_STATUS::set(0, peaks.temperature_max > TEMPERATURE_THRESHOLD_HIGH) |
+           HDC2022Map::STATUS::HH_STATUS::set(0, peaks.humidity_max > HUMIDITY_THRESHOLD_HIGH);
 
 }
 
@@ -166,8 +706,7 @@ float HDC2022_c::get_Humidity()
 uint8_t HDC2022_c::get_Status()
 {
 
-    STATUS.val = I2C_getByte(ADDR_STATUS);
-    return STATUS.val;
+    return I2C_getByte(ADDR_STATUS);
 
 }
 
@@ -481,3 +1020,297 @@ uint8_t HDC2022_c::get_DeviceIDHIGH()
 
 }
 
+/**
+ * @brief  Encode Temperature Threshold
+ * @note	Threshold registers compare against the 8 MSB of the temperature data : T = (code / 2^8) * 165 - 40
+ * 		Out of range values are clamped to 0x00 / 0xFF
+ * @param  float temperature	:	Threshold as a Celsius (°C)
+ * @retval uint8_t			:	Threshold register code
+ */
+uint8_t HDC2022_c::encode_TemperatureThreshold(float temperature)
+{
+
+    float code = (temperature + 40.0f) * (256.0f / 165.0f) + 0.5f;
+
+    if (code <= 0.0f)
+    {
+        return 0x00;
+    }
+    if (code >= 255.0f)
+    {
+        return 0xFF;
+    }
+    return (uint8_t)code;
+
+}
+
+/**
+ * @brief  Encode Humidity Threshold
+ * @note	Threshold registers compare against the 8 MSB of the humidity data : RH = (code / 2^8) * 100
+ * 		Out of range values are clamped to 0x00 / 0xFF
+ * @param  float humidity	:	Threshold as a Relative Humidity (%RH)
+ * @retval uint8_t		:	Threshold register code
+ */
+uint8_t HDC2022_c::encode_HumidityThreshold(float humidity)
+{
+
+    float code = humidity * (256.0f / 100.0f) + 0.5f;
+
+    if (code <= 0.0f)
+    {
+        return 0x00;
+    }
+    if (code >= 255.0f)
+    {
+        return 0xFF;
+    }
+    return (uint8_t)code;
+
+}
+
+/**
+ * @brief  Decode Temperature Threshold
+ * @note	Also valid for TEMPERATURE_MAX register
+ * @param  uint8_t code	:	Threshold register code
+ * @retval float			:	Threshold as a Celsius (°C)
+ */
+float HDC2022_c::decode_TemperatureThreshold(uint8_t code)
+{
+
+    return code * (165.0f / 256.0f) - 40.0f;
+
+}
+
+/**
+ * @brief  Decode Humidity Threshold
+ * @note	Also valid for HUMIDITY_MAX register
+ * @param  uint8_t code	:	Threshold register code
+ * @retval float			:	Threshold as a Relative Humidity (%RH)
+ */
+float HDC2022_c::decode_HumidityThreshold(uint8_t code)
+{
+
+    return code * (100.0f / 256.0f);
+
+}
+
+/**
+ * @brief  Decode Temperature Code
+ * @note	T(°C) = (code / 2^16) * 165 - 40
+ * @param  uint16_t code	:	TEMPERATURE_HIGH:TEMPERATURE_LOW
+ * @retval float			:	Temperature as a Celsius (°C)
+ */
+float HDC2022_c::decode_Temperature(uint16_t code)
+{
+
+    return code * (165.0f / 65536.0f) - 40.0f;
+
+}
+
+/**
+ * @brief  Decode Humidity Code
+ * @note	RH(%) = (code / 2^16) * 100
+ * @param  uint16_t code	:	HUMIDITY_HIGH:HUMIDITY_LOW
+ * @retval float			:	Relative Humidity (%RH)
+ */
+float HDC2022_c::decode_Humidity(uint16_t code)
+{
+
+    return code * (100.0f / 65536.0f);
+
+}
+
+/**
+ * @brief  Set Temperature Alarm Window
+ * @note	Writes both threshold registers and enables TL/TH interrupts, the pin is driven after arm_Alarm()
+ * @param  float low		:	Low threshold as a Celsius (°C)
+ * @param  float high		:	High threshold as a Celsius (°C)
+ * @retval None
+ */
+void HDC2022_c::set_TemperatureAlarm(float low, float high)
+{
+
+    TEMPERATURE_THRESHOLD_LOW = encode_TemperatureThreshold(low);
+    TEMPERATURE_THRESHOLD_HIGH = encode_TemperatureThreshold(high);
+    set_TemperatureLOWThreshold();
+    set_TemperatureHIGHThreshold();
+
+    write_Fields(HDC2022Map::INTERRUPT_ENABLE::TL_ENABLE::value(1) | HDC2022Map::INTERRUPT_ENABLE::TH_ENABLE::value(1));
+
+}
+
+/**
+ * @brief  Set Humidity Alarm Window
+ * @note	Writes both threshold registers and enables HL/HH interrupts, the pin is driven after arm_Alarm()
+ * @param  float low		:	Low threshold as a Relative Humidity (%RH)
+ * @param  float high		:	High threshold as a Relative Humidity (%RH)
+ * @retval None
+ */
+void HDC2022_c::set_HumidityAlarm(float low, float high)
+{
+
+    HUMIDITY_THRESHOLD_LOW = encode_HumidityThreshold(low);
+    HUMIDITY_THRESHOLD_HIGH = encode_HumidityThreshold(high);
+    set_HumidityLOWThreshold();
+    set_HumidityHIGHThreshold();
+
+    write_Fields(HDC2022Map::INTERRUPT_ENABLE::HL_ENABLE::value(1) | HDC2022Map::INTERRUPT_ENABLE::HH_ENABLE::value(1));
+
+}
+
+/**
+ * @brief  Arm Threshold Comparators
+ * @note	Starts auto measurement mode and enables the DRDY/INT pin, the sensor then compares every
+ * 		conversion against the thresholds without any bus traffic from the MCU
+ * @param  rate_t rate			:	Auto measurement rate, must not be RATE_ONE_SHOT for unattended monitoring
+ * @param  uint8_t active_high	:	0 = Active Low, 1 = Active High
+ * @param  uint8_t comparator	:	0 = Clear-on-read (latched), 1 = Comparator (follows the condition)
+ * @retval None
+ */
+void HDC2022_c::arm_Alarm(rate_t rate, uint8_t active_high, uint8_t comparator)
+{
+
+    typedef HDC2022Map::DEVICE_CONFIGURATION DEVCFG;
+
+    write_Fields(DEVCFG::CC::value(rate) | DEVCFG::INT_POL::value(active_high) |
+                 DEVCFG::INT_MODE::value(comparator) | DEVCFG::DRDY_INT_EN::value(1));
+
+    trigger_Measurement();
+
+}
+
+/**
+ * @brief  Trigger Measurement
+ * @note	Starts a conversion with the current MEASUREMENT_CONFIGURATION, one conversion in RATE_ONE_SHOT,
+ * 		DRDY is raised when the result is ready
+ * @param  None
+ * @retval None
+ */
+void HDC2022_c::trigger_Measurement()
+{
+
+    /*  MEAS_TRIG self-clears on the device, it is written but not kept in the shadow */
+    I2C_setByte(ADDR_MEASUREMENT_CONFIGURATION,
+                HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(MEASUREMENT_CONFIGURATION.val, 1));
+
+}
+
+/**
+ * @brief  Disarm Threshold Comparators
+ * @note	Disables TL/TH/HL/HH interrupts and puts the DRDY/INT pin in High Z, measurement rate is kept
+ * @param  None
+ * @retval None
+ */
+void HDC2022_c::disarm_Alarm()
+{
+
+    typedef HDC2022Map::INTERRUPT_ENABLE INTEN;
+
+    write_Fields(INTEN::TL_ENABLE::value(0) | INTEN::TH_ENABLE::value(0) |
+                 INTEN::HL_ENABLE::value(0) | INTEN::HH_ENABLE::value(0));
+    write_Fields(HDC2022Map::DEVICE_CONFIGURATION::DRDY_INT_EN::value(0));
+
+}
+
+/**
+ * @brief  Get Alarm Status
+ * @note	Threshold bits of the STATUS register (TH/TL/HH/HL), cleared by this read in clear-on-read mode
+ * @param  None
+ * @retval uint8_t
+ */
+uint8_t HDC2022_c::get_AlarmStatus()
+{
+
+    return get_Status() & (HDC2022Map::STATUS::TH_STATUS::mask | HDC2022Map::STATUS::TL_STATUS::mask |
+                           HDC2022Map::STATUS::HH_STATUS::mask | HDC2022Map::STATUS::HL_STATUS::mask);
+
+}
+
+/**
+ * @brief  Set Retry Count
+ * @note	Extra attempts after a failed transaction, 0 disables retries and recovery
+ * @param  uint8_t retries
+ * @retval None
+ */
+void HDC2022_c::set_Retry(uint8_t retries)
+{
+
+    i2c_retries = retries;
+
+}
+
+/**
+ * @brief  Set Bus Recovery Pins
+ * @note	SCL/SDA pins of the I2C handler, used to clock out a stuck slave during recovery.
+ * 		Example : set_RecoveryPins(GPIOB, GPIO_PIN_6, GPIOB, GPIO_PIN_7);
+ * @param  GPIO_TypeDef *scl_port	:	SCL port
+ * @param  uint16_t scl_pin		:	SCL pin
+ * @param  GPIO_TypeDef *sda_port	:	SDA port
+ * @param  uint16_t sda_pin		:	SDA pin
+ * @retval None
+ */
+void HDC2022_c::set_RecoveryPins(GPIO_TypeDef *scl_port, uint16_t scl_pin, GPIO_TypeDef *sda_port, uint16_t sda_pin)
+{
+
+    this->scl_port = scl_port;
+    this->scl_pin = scl_pin;
+    this->sda_port = sda_port;
+    this->sda_pin = sda_pin;
+
+}
+
+/**
+ * @brief  Get Last Transaction Result
+ * @note	None
+ * @param  None
+ * @retval result_t
+ */
+HDC2022_c::result_t HDC2022_c::get_LastResult()
+{
+
+    return (result_t)i2c_result;
+
+}
+
+/**
+ * @brief  Get Bus Statistics
+ * @note	worst_cycles / (SystemCoreClock / 1000000) gives the worst sample latency in microseconds
+ * @param  None
+ * @retval const i2c_stats_t &
+ */
+const HDC2022_c::i2c_stats_t &HDC2022_c::get_Statistics()
+{
+
+    return i2c_stats;
+
+}
+
+/**
+ * @brief  Get I2C Handle
+ * @note	The handle given to Init(), NULL before Init()
+ * @param  None
+ * @retval I2C_HandleTypeDef *
+ */
+I2C_HandleTypeDef *HDC2022_c::get_Handle()
+{
+
+    return i2c;
+
+}
+
+/**
+ * @brief  Attach Shared I2C Bus
+ * @note   From now on every register access is queued on the bus as a transaction, so it no longer
+ * 		collides with interrupt driven transfers of other drivers. Bus recovery holds the queue.
+ * 		The bus must run on get_Handle()
+ * @param  I2CBus_c *bus		:	Initialized bus, NULL = direct blocking HAL calls again
+ * @param  uint8_t priority	:	Transaction priority, 0 = highest
+ * @retval None
+ */
+void HDC2022_c::attach_Bus(I2CBus_c *bus, uint8_t priority)
+{
+
+    this->bus = bus;
+    bus_priority = priority;
+
+}
@@ -16,17 +16,33 @@
 
 #include <stdint.h>
 #include <stm32l4xx_hal.h>
+#include <HDC2022Regs.hpp>
 
+class I2CBus_c;
 
 class HDC2022_c {
 
 public:
-  
-  void      Init (I2C_HandleTypeDef I2C_Handler, uint8_t timeout);
+
+  typedef enum
+  {
+    RESULT_OK = 0x00,                 /*  Transfer completed                                         */
+    RESULT_NACK,                      /*  Device did not acknowledge after all retries               */
+    RESULT_TIMEOUT,                   /*  Transfer did not complete within i2c_timeout               */
+    RESULT_BUS_ERROR,                 /*  Bus error or arbitration lost, bus recovery was run        */
+    RESULT_BUSY,                      /*  Peripheral stayed busy, bus recovery was run               */
+    RESULT_WRONG_DEVICE,              /*  Answered, but the ID registers are not an HDC2022's        */
+  }result_t; /* Outcome of the last bus transaction  */
+
+  result_t  Init (I2C_HandleTypeDef &I2C_Handler, uint8_t timeout);
   void      DeInit ();
 
+  typedef hdc_raw_sample_t raw_sample_t;
+
   float     get_Temperature();
   float     get_Humidity();
+  uint16_t  get_TemperatureRaw();
+  uint16_t  get_HumidityRaw();
   uint8_t   get_Status();
 
   uint8_t   get_MAXTemperature();
@@ -65,6 +81,96 @@ public:
   uint8_t   get_DeviceIDLOW();
   uint8_t   get_DeviceIDHIGH();
 
+  typedef enum
+  {
+    RATE_ONE_SHOT = 0x00,             /*  Auto measurement disabled, trigger with MEAS_TRIG          */
+    RATE_1_120HZ,                     /*  1 sample every 2 minutes                                   */
+    RATE_1_60HZ,                      /*  1 sample every minute                                      */
+    RATE_0_1HZ,                       /*  1 sample every 10 seconds                                  */
+    RATE_0_2HZ,                       /*  1 sample every 5 seconds                                   */
+    RATE_1HZ,                         /*  1 sample every second                                      */
+    RATE_2HZ,                         /*  2 samples every second                                     */
+    RATE_5HZ,                         /*  5 samples every second                                     */
+  }rate_t; /* Auto measurement mode rates, DEVICE_CONFIGURATION.bits.CC  */
+
+  static uint8_t encode_TemperatureThreshold(float temperature);
+  static uint8_t encode_HumidityThreshold(float humidity);
+  static float   decode_TemperatureThreshold(uint8_t code);
+  static float   decode_HumidityThreshold(uint8_t code);
+  static float   decode_Temperature(uint16_t code);
+  static float   decode_Humidity(uint16_t code);
+
+  void      set_TemperatureAlarm(float low, float high);
+  void      set_HumidityAlarm(float low, float high);
+  void      arm_Alarm(rate_t rate, uint8_t active_high, uint8_t comparator);
+  void      trigger_Measurement();
+  void      disarm_Alarm();
+  uint8_t   get_AlarmStatus();
+
+  typedef struct
+  {
+    uint32_t transfers;               /*  Completed or failed transactions                           */
+    uint32_t retries;                 /*  Extra attempts after a failed one                          */
+    uint32_t recoveries;              /*  SCL clocking + peripheral re-init sequences                */
+    uint32_t failures;                /*  Transactions that returned an error to the caller          */
+    uint32_t worst_cycles;            /*  Longest transaction including retries (core cycles)        */
+  }i2c_stats_t;
+
+  void      set_Retry(uint8_t retries);
+  void      set_RecoveryPins(GPIO_TypeDef *scl_port, uint16_t scl_pin, GPIO_TypeDef *sda_port, uint16_t sda_pin);
+  result_t  get_LastResult();
+  result_t  get_Sample(raw_sample_t &sample);
+
+  static constexpr uint16_t ManufacturerID = 0x5449;
+  static constexpr uint16_t DeviceIDValue = 0x07D0;
+
+  result_t  probe(I2C_HandleTypeDef &I2C_Handler, uint8_t timeout);
+  result_t  read_ID(uint16_t &manufacturer, uint16_t &device);
+  uint8_t   get_Address();
+  static uint8_t probe_Array(HDC2022_c *sensors, uint8_t count, I2C_HandleTypeDef *const *buses, uint8_t bus_count, uint8_t timeout);
+
+  static constexpr uint8_t ConfigurationSize = 9;
+
+  void      get_Configuration(uint8_t *configuration);
+  result_t  soft_Reset(uint32_t timeout_ms);
+
+  typedef hdc_peak_sample_t peak_sample_t;
+
+  result_t  get_Peaks(peak_sample_t &peaks);
+  result_t  reset_Peaks(uint32_t timeout_ms);
+  uint8_t   get_PeakAlarm(const peak_sample_t &peaks);
+  const i2c_stats_t &get_Statistics();
+  I2C_HandleTypeDef *get_Handle();
+  void      attach_Bus(I2CBus_c *bus, uint8_t priority);
+
+  /**
+   * @brief  Write Register Fields
+   * @note	Fields of one register combined with |, see HDC2022Regs.hpp. The shadow is updated with one
+   * 		mask and the register written once, other fields keep their shadow value
+   * @param  hdc_field_value_t<ADDRESS> fields
+   * @retval None
+   */
+  template<uint8_t ADDRESS>
+  void      write_Fields(hdc_field_value_t<ADDRESS> fields)
+  {
+      uint8_t &shadow = shadow_Of((addr_t)ADDRESS);
+
+      shadow = fields.apply(shadow);
+      I2C_setByte((addr_t)ADDRESS, shadow);
+  }
+
+  /**
+   * @brief  Read Register Field
+   * @note	Reads the register of FIELD from the device, e.g. read_Field<HDC2022Map::STATUS::DRDY_STATUS>()
+   * @param  None
+   * @retval uint8_t	:	Field value, shifted down
+   */
+  template<typename FIELD>
+  uint8_t   read_Field()
+  {
+      return FIELD::get(I2C_getByte((addr_t)FIELD::address));
+  }
+
 
 
  union
@@ -158,74 +264,74 @@ uint8_t HUMIDITY_THRESHOLD_HIGH;    /*  Humidity threshold HIGH value     */
 
 private:
 
-I2C_HandleTypeDef i2c;
+/*
+ *  Packed after the 9 shadow bytes above, pointers and statistics last : 56 bytes per instance on the
+ *  target (164 with the handle copy and the read-only register shadows), pinned in HDC2022.cpp.
+ *  Data, status, MAX and ID registers are read on demand and not kept.
+ */
 uint8_t i2c_timeout = 100;
-uint8_t DeviceID;
-uint8_t DeviceIDHigh = 0x41<<1;
-uint8_t DeviceIDLow = 0x40<<1;
-uint8_t buffer_8[5];
-
-uint8_t TEMPERATURE_LOW;  /* Temperature data- lower byte  */
-uint8_t TEMPERATURE_HIGH; /* Temperature data- higher byte */
-
-uint8_t HUMIDITY_LOW;     /*  Humidity data- lower byte    */
-uint8_t HUMIDITY_HIGH;    /*  Humidity data- higher byte   */
-
-
- union
-{
-       uint8_t val;
-       union{
-                 struct
-                {
-                  uint8_t :3;            /*  Reserved                                   */
-                  uint8_t HL_STATUS:1;   /* Humidity threshold LOW Interrupt status     */
-                  uint8_t HH_STATUS:1;   /* Humidity threshold HIGH Interrupt status    */
-                  uint8_t TL_STATUS:1;   /* Temperature threshold LOW Interrupt status  */
-                  uint8_t TH_STATUS:1;   /* Temperature threshold HIGH Interrupt status */
-                  uint8_t DRDY_STATUS:1; /* DataReady bit status                        */
-                };
-       }bits;
-}STATUS;
-
-uint8_t TEMPERATURE_MAX; /* Maximum temperature measurement data (one-shot mode only) */
-uint8_t HUMIDITY_MAX;    /* Maximum humidity measurement data (one-shot mode only)    */
-
-
-
-uint8_t MANUFACTURER_ID_LOW;  /*  The Manufacturer ID Low and Manufacturer ID High registers contain a factory-programmable identification value that identifies this device as being manufactured by Texas Instruments.  */
-uint8_t MANUFACTURER_ID_HIGH; /*  The Manufacturer ID Low and Manufacturer ID High registers contain a factory-programmable identification value that identifies this device as being manufactured by Texas Instruments.  */
-
-uint8_t DEVICE_ID_LOW;        /*  The Device ID Low and Device ID High registers contain a factory-programmable identification value that identifies this device as a HDC2022.  */
-uint8_t DEVICE_ID_HIGH;       /*  The Device ID Low and Device ID High registers contain a factory-programmable identification value that identifies this device as a HDC2022.  */
-
+uint8_t DeviceID = DeviceIDLow;
+uint8_t i2c_retries = 2;
+uint8_t bus_priority = 0;
+uint8_t i2c_result = RESULT_OK;       /*  result_t, stored as one byte                               */
+uint16_t scl_pin;
+uint16_t sda_pin;
+I2C_HandleTypeDef *i2c = NULL;        /*  Handle given to Init(), owned by the application           */
+I2CBus_c *bus = NULL;
+GPIO_TypeDef *scl_port = NULL;
+GPIO_TypeDef *sda_port = NULL;
+i2c_stats_t i2c_stats = {};
+
+static constexpr uint8_t DeviceIDHigh = 0x41<<1;
+static constexpr uint8_t DeviceIDLow = 0x40<<1;
 
    typedef enum
   {
-    ADDR_TEMPERATURE_LOW = 0x00,      /*  R    Temperature data [7:0]                                   */
-    ADDR_TEMPERATURE_HIGH,            /*  R    Temperature data [15:8]                                  */
-    ADDR_HUMIDITY_LOW,                /*  R    Humidity data [7:0]                                      */
-    ADDR_HUMIDITY_HIGH,               /*  R    Humidity data [15:8]                                     */
-    ADDR_STATUS,                      /*  R    DataReady and threshold status                           */
-    ADDR_TEMPERATURE_MAX,             /*  R    Maximum measured temperature (one-shot mode only)        */
-    ADDR_HUMIDITY_MAX,                /*  R    Maximum measured humidity (one-shot mode only)           */
-    ADDR_INTERRUPT_ENABLE,            /*  R/W  Interrupt enable                                         */
-    ADDR_TEMP_OFFSET_ADJUST,          /*  R/W  Temperature offset adjustment                            */
-    ADDR_HUM_OFFSET_ADJUST,           /*  R/W  Humidity offset adjustment                               */
-    ADDR_TEMP_THR_L,                  /*  R/W  Temperature threshold low                                */
-    ADDR_TEMP_THR_H,                  /*  R/W  Temperature threshold high                               */
-    ADDR_RH_THR_L,                    /*  R/W  Humidity threshold low                                   */
-    ADDR_RH_THR_H,                    /*  R/W  Humidity threshold high                                  */
-    ADDR_DEVICE_CONFIGURATION,        /*  R/W  Soft reset and interrupt reporting configuration         */
-    ADDR_MEASUREMENT_CONFIGURATION,   /*  R/W  Device measurement configuration                         */
-    ADDR_MANUFACTURER_ID_LOW = 0xFC,  /*  R    Manufacturer ID lower-byte                               */
-    ADDR_MANUFACTURER_ID_HIGH,        /*  R    Manufacturer ID higher-byte                              */
-    ADDR_DEVICE_ID_LOW,               /*  R    Device ID lower-byte                                     */
-    ADDR_DEVICE_ID_HIGH,              /*  R    Device ID higher-byte                                    */
-  }addr_t;
-
-  void    I2C_setByte(addr_t reg, uint8_t val);
-  uint8_t I2C_getByte(addr_t reg);
+    ADDR_TEMPERATURE_LOW = HDC2022Map::TEMPERATURE_LOW::address,                     /*  R    Temperature data [7:0]                                   */
+    ADDR_TEMPERATURE_HIGH = HDC2022Map::TEMPERATURE_HIGH::address,                   /*  R    Temperature data [15:8]                                  */
+    ADDR_HUMIDITY_LOW = HDC2022Map::HUMIDITY_LOW::address,                           /*  R    Humidity data [7:0]                                      */
+    ADDR_HUMIDITY_HIGH = HDC2022Map::HUMIDITY_HIGH::address,                         /*  R    Humidity data [15:8]                                     */
+    ADDR_STATUS = HDC2022Map::STATUS::address,                                       /*  R    DataReady and threshold status                           */
+    ADDR_TEMPERATURE_MAX = HDC2022Map::TEMPERATURE_MAX::address,                     /*  R    Maximum measured temperature (one-shot mode only)        */
+    ADDR_HUMIDITY_MAX = HDC2022Map::HUMIDITY_MAX::address,                           /*  R    Maximum measured humidity (one-shot mode only)           */
+    ADDR_INTERRUPT_ENABLE = HDC2022Map::INTERRUPT_ENABLE::address,                   /*  R/W  Interrupt enable                                         */
+    ADDR_TEMP_OFFSET_ADJUST = HDC2022Map::TEMP_OFFSET_ADJUST::address,               /*  R/W  Temperature offset adjustment                            */
+    ADDR_HUM_OFFSET_ADJUST = HDC2022Map::HUM_OFFSET_ADJUST::address,                 /*  R/W  Humidity offset adjustment                               */
+    ADDR_TEMP_THR_L = HDC2022Map::TEMP_THR_L::address,                               /*  R/W  Temperature threshold low                                */
+    ADDR_TEMP_THR_H = HDC2022Map::TEMP_THR_H::address,                               /*  R/W  Temperature threshold high                               */
+    ADDR_RH_THR_L = HDC2022Map::RH_THR_L::address,                                   /*  R/W  Humidity threshold low                                   */
+    ADDR_RH_THR_H = HDC2022Map::RH_THR_H::address,                                   /*  R/W  Humidity threshold high                                  */
+    ADDR_DEVICE_CONFIGURATION = HDC2022Map::DEVICE_CONFIGURATION::address,           /*  R/W  Soft reset and interrupt reporting configuration         */
+    ADDR_MEASUREMENT_CONFIGURATION = HDC2022Map::MEASUREMENT_CONFIGURATION::address, /*  R/W  Device measurement configuration                         */
+    ADDR_MANUFACTURER_ID_LOW = HDC2022Map::MANUFACTURER_ID_LOW::address,             /*  R    Manufacturer ID lower-byte                               */
+    ADDR_MANUFACTURER_ID_HIGH = HDC2022Map::MANUFACTURER_ID_HIGH::address,           /*  R    Manufacturer ID higher-byte                              */
+    ADDR_DEVICE_ID_LOW = HDC2022Map::DEVICE_ID_LOW::address,                         /*  R    Device ID lower-byte                                     */
+    ADDR_DEVICE_ID_HIGH = HDC2022Map::DEVICE_ID_HIGH::address,                       /*  R    Device ID higher-byte                                    */
+  }addr_t; /* Generated from HDC2022Map, checked by Tools/RegisterMapCheck  */
+
+  uint8_t &shadow_Of(addr_t reg)
+  {
+      switch (reg)
+      {
+        case ADDR_TEMP_OFFSET_ADJUST:         return TEMPERATURE_OFFSET_ADJUSTMENT.val;
+        case ADDR_HUM_OFFSET_ADJUST:          return HUMIDITY_OFFSET_ADJUSTMENT.val;
+        case ADDR_TEMP_THR_L:                 return TEMPERATURE_THRESHOLD_LOW;
+        case ADDR_TEMP_THR_H:                 return TEMPERATURE_THRESHOLD_HIGH;
+        case ADDR_RH_THR_L:                   return HUMIDITY_THRESHOLD_LOW;
+        case ADDR_RH_THR_H:                   return HUMIDITY_THRESHOLD_HIGH;
+        case ADDR_DEVICE_CONFIGURATION:       return DEVICE_CONFIGURATION.val;
+        case ADDR_MEASUREMENT_CONFIGURATION:  return MEASUREMENT_CONFIGURATION.val;
+        default:                              return INTERRUPT_ENABLE.val;      /*  Only R/W registers have fields with value()  */
+      }
+  }
+
+  result_t I2C_transfer(addr_t reg, uint8_t *buf, uint16_t len, uint8_t write);
+  result_t identify(I2C_HandleTypeDef *handle, uint8_t address, uint8_t timeout);
+  void     configure();
+  void     I2C_recover();
+  result_t bus_transfer(addr_t reg, uint8_t *buf, uint16_t len, uint8_t write);
+  void     I2C_setByte(addr_t reg, uint8_t val);
+  uint8_t  I2C_getByte(addr_t reg);
 
 
 };
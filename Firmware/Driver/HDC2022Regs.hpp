@@ -0,0 +1,164 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        HDC2022 register map as compile-time register and field descriptions
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HDC2022REGS_HPP_
+#define _HDC2022REGS_HPP_
+
+#include <stdint.h>
+
+/*
+ *  Every register is a type with its address, access and reset value, every field a type with its
+ *  register, shift and mask (datasheet section 7.6). Everything is constexpr : get() folds to a shift and
+ *  a mask, value() to a constant, and values of one register combine with | into one masked write.
+ *  Values of different registers do not combine and read-only fields have no value(), both fail to compile.
+ *
+ *  Example Usage
+ *
+ *	typedef HDC2022Map::DEVICE_CONFIGURATION DEVCFG;
+ *	HDC2022.write_Fields(DEVCFG::CC::value(HDC2022_c::RATE_1HZ) | DEVCFG::DRDY_INT_EN::value(1));
+ *	if (HDC2022Map::STATUS::DRDY_STATUS::get(status)) { ... }
+ *
+ *  Firmware/Tools/RegisterMapCheck checks the map against the datasheet tables on the host.
+ */
+
+typedef struct
+{
+  uint16_t temperature;               /*  TEMPERATURE_HIGH:TEMPERATURE_LOW code                      */
+  uint16_t humidity;                  /*  HUMIDITY_HIGH:HUMIDITY_LOW code                            */
+}hdc_raw_sample_t; /* One sample as read, converted to units only where they are shown or compared  */
+
+typedef struct
+{
+  hdc_raw_sample_t last;              /*  Latest conversion                                          */
+  uint8_t status;                     /*  STATUS as read, the read cleared it on the device          */
+  uint8_t temperature_max;            /*  TEMPERATURE_MAX, 8 bit code on the threshold scale         */
+  uint8_t humidity_max;               /*  HUMIDITY_MAX, 8 bit code on the threshold scale            */
+}hdc_peak_sample_t; /* TEMPERATURE_LOW .. HUMIDITY_MAX, one 7 byte burst                            */
+
+typedef enum
+{
+  HDC_R  = 0x01,                      /*  Read only                                                  */
+  HDC_RW = 0x03,                      /*  Read / write                                               */
+}hdc_access_t;
+
+template<uint8_t ADDRESS>
+struct hdc_field_value_t
+{
+  uint8_t mask;                       /*  Bits written                                               */
+  uint8_t bits;                       /*  New value of these bits, already shifted                   */
+
+  constexpr uint8_t apply(uint8_t reg) const  { return (uint8_t)((reg & ~mask) | bits); }
+};
+
+template<uint8_t ADDRESS>
+constexpr hdc_field_value_t<ADDRESS> operator|(hdc_field_value_t<ADDRESS> a, hdc_field_value_t<ADDRESS> b)
+{
+    return { (uint8_t)(a.mask | b.mask), (uint8_t)((a.bits & ~b.mask) | b.bits) };
+}
+
+template<uint8_t ADDRESS, uint8_t ACCESS, uint8_t RESET>
+struct hdc_register_t
+{
+  static constexpr uint8_t address = ADDRESS;
+  static constexpr uint8_t access = ACCESS;
+  static constexpr uint8_t reset = RESET;
+};
+
+template<typename REGISTER, uint8_t SHIFT, uint8_t WIDTH>
+struct hdc_field_t
+{
+  static constexpr uint8_t address = REGISTER::address;
+  static constexpr uint8_t shift = SHIFT;
+  static constexpr uint8_t width = WIDTH;
+  static constexpr uint8_t mask = (uint8_t)(((1U << WIDTH) - 1U) << SHIFT);
+
+  static constexpr uint8_t get(uint8_t reg)                   { return (uint8_t)((reg & mask) >> SHIFT); }
+  static constexpr uint8_t set(uint8_t reg, uint8_t value)    { return value_Of(value).apply(reg); }
+
+  static constexpr hdc_field_value_t<REGISTER::address> value(uint8_t value)
+  {
+      static_assert(REGISTER::access == HDC_RW, "HDC2022 : field is read only");
+      return value_Of(value);
+  }
+
+  static_assert((WIDTH != 0) && (SHIFT + WIDTH <= 8), "HDC2022 : field outside of its register");
+
+private:
+
+  static constexpr hdc_field_value_t<REGISTER::address> value_Of(uint8_t value)
+  {
+      return { mask, (uint8_t)((value << SHIFT) & mask) };
+  }
+
+};
+
+struct HDC2022Map
+{
+  typedef hdc_register_t<0x00, HDC_R, 0x00>  TEMPERATURE_LOW;
+  typedef hdc_register_t<0x01, HDC_R, 0x00>  TEMPERATURE_HIGH;
+  typedef hdc_register_t<0x02, HDC_R, 0x00>  HUMIDITY_LOW;
+  typedef hdc_register_t<0x03, HDC_R, 0x00>  HUMIDITY_HIGH;
+
+  struct STATUS : hdc_register_t<0x04, HDC_R, 0x00>
+  {
+    typedef hdc_field_t<STATUS, 7, 1> DRDY_STATUS;
+    typedef hdc_field_t<STATUS, 6, 1> TH_STATUS;
+    typedef hdc_field_t<STATUS, 5, 1> TL_STATUS;
+    typedef hdc_field_t<STATUS, 4, 1> HH_STATUS;
+    typedef hdc_field_t<STATUS, 3, 1> HL_STATUS;
+  };
+
+  typedef hdc_register_t<0x05, HDC_R, 0x00>  TEMPERATURE_MAX;
+  typedef hdc_register_t<0x06, HDC_R, 0x00>  HUMIDITY_MAX;
+
+  struct INTERRUPT_ENABLE : hdc_register_t<0x07, HDC_RW, 0x00>
+  {
+    typedef hdc_field_t<INTERRUPT_ENABLE, 7, 1> DRDY_ENABLE;
+    typedef hdc_field_t<INTERRUPT_ENABLE, 6, 1> TH_ENABLE;
+    typedef hdc_field_t<INTERRUPT_ENABLE, 5, 1> TL_ENABLE;
+    typedef hdc_field_t<INTERRUPT_ENABLE, 4, 1> HH_ENABLE;
+    typedef hdc_field_t<INTERRUPT_ENABLE, 3, 1> HL_ENABLE;
+  };
+
+  typedef hdc_register_t<0x08, HDC_RW, 0x00> TEMP_OFFSET_ADJUST;
+  typedef hdc_register_t<0x09, HDC_RW, 0x00> HUM_OFFSET_ADJUST;
+  typedef hdc_register_t<0x0A, HDC_RW, 0x01> TEMP_THR_L;
+  typedef hdc_register_t<0x0B, HDC_RW, 0xFF> TEMP_THR_H;
+  typedef hdc_register_t<0x0C, HDC_RW, 0x00> RH_THR_L;
+  typedef hdc_register_t<0x0D, HDC_RW, 0xFF> RH_THR_H;
+
+  struct DEVICE_CONFIGURATION : hdc_register_t<0x0E, HDC_RW, 0x00>
+  {
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 7, 1> SOFT_RES;
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 4, 3> CC;
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 3, 1> HEAT_EN;
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 2, 1> DRDY_INT_EN;
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 1, 1> INT_POL;
+    typedef hdc_field_t<DEVICE_CONFIGURATION, 0, 1> INT_MODE;
+  };
+
+  struct MEASUREMENT_CONFIGURATION : hdc_register_t<0x0F, HDC_RW, 0x00>
+  {
+    typedef hdc_field_t<MEASUREMENT_CONFIGURATION, 6, 2> TACC;
+    typedef hdc_field_t<MEASUREMENT_CONFIGURATION, 4, 2> HACC;
+    typedef hdc_field_t<MEASUREMENT_CONFIGURATION, 1, 2> MEAS_CONF;
+    typedef hdc_field_t<MEASUREMENT_CONFIGURATION, 0, 1> MEAS_TRIG;
+  };
+
+  typedef hdc_register_t<0xFC, HDC_R, 0x49>  MANUFACTURER_ID_LOW;
+  typedef hdc_register_t<0xFD, HDC_R, 0x54>  MANUFACTURER_ID_HIGH;
+  typedef hdc_register_t<0xFE, HDC_R, 0xD0>  DEVICE_ID_LOW;
+  typedef hdc_register_t<0xFF, HDC_R, 0x07>  DEVICE_ID_HIGH;
+};
+
+#endif
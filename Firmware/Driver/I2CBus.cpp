@@ -0,0 +1,559 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Prioritized transaction queue for a shared I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <I2CBus.hpp>
+#include <Trace.hpp>
+#include <Placement.h>
+#include <string.h>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <I2CBus.hpp>
+ *	I2CBus_c I2CBus;
+ *	static uint8_t id[2];
+ *	static i2c_txn_t txn_id = { 0x40 << 1, 0xFC, 0, 2, id, sizeof(id), 0, on_Id };
+ * 	void main()
+ * 	{
+ * 	 I2CBus.Init(HDC2022.get_Handle(), HAL_GetTick);
+ * 	 HDC2022.attach_Bus(&I2CBus, 1);				// blocking driver calls are queued as well
+ * 	 I2CBus.submit(&txn_id);						// on_Id(&txn_id) runs from the I2C interrupt
+ * 	}
+ */
+
+static I2CBus_c *bus_owner = NULL;
+
+/**
+ * @brief  Bus Initialization Function
+ * @note   Enables the I2C1 event and error interrupts, the handle must be initialized.
+ * 		Pass the handle given to HDC2022_c::Init() (HDC2022.get_Handle()), the bus recovery resets it
+ * @param  I2C_HandleTypeDef *hi2c	:	I2C handle of the shared bus
+ * @param  clock_fn_t now_ms		:	Millisecond clock of the deadlines, NULL = HAL_GetTick
+ * @retval None
+ */
+void I2CBus_c::Init(I2C_HandleTypeDef *hi2c, clock_fn_t now_ms)
+{
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    this->hi2c = hi2c;
+    this->now_ms = now_ms ? now_ms : HAL_GetTick;
+    bus_owner = this;
+
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+
+}
+
+/**
+ * @brief  Submit Transaction
+ * @note   Interrupt safe. Starts the transaction at once when the bus is idle
+ * @param  i2c_txn_t *txn	:	Descriptor, owned by the bus until its status leaves I2C_BUS_PENDING
+ * @retval uint8_t		:	1 = queued, 0 = queue full
+ */
+RAM2_FUNC uint8_t I2CBus_c::submit(i2c_txn_t *txn)
+{
+
+    uint32_t primask;
+
+    txn->status = I2C_BUS_PENDING;
+    txn->merged = NULL;
+    txn->stamp = DWT->CYCCNT;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (stats.depth >= I2C_BUS_QUEUE)
+    {
+        stats.rejected++;
+        __set_PRIMASK(primask);
+        return 0;
+    }
+
+    queue[stats.depth++] = txn;
+    if (stats.depth > stats.worst_depth)
+    {
+        stats.worst_depth = stats.depth;
+    }
+    stats.submitted++;
+    TRACE(TRACE_BUS_PUSH, ((uint32_t)stats.depth << 16) | ((uint32_t)txn->address << 8) | txn->reg);
+    start();
+    __set_PRIMASK(primask);
+
+    return 1;
+
+}
+
+/**
+ * @brief  Blocking Transfer
+ * @note   Thread context only. Submits and waits, a transaction still queued or in flight after timeout_ms
+ * 		is cancelled, an in-flight one by resetting the peripheral
+ * @param  i2c_txn_t *txn		:	Descriptor, may live on the caller stack
+ * @param  uint32_t timeout_ms	:	Queueing plus transfer time
+ * @retval uint8_t			:	I2C_BUS_OK .. I2C_BUS_REJECTED
+ */
+uint8_t I2CBus_c::transfer(i2c_txn_t *txn, uint32_t timeout_ms)
+{
+
+    uint32_t start = HAL_GetTick();
+
+    if (!submit(txn))
+    {
+        return I2C_BUS_REJECTED;
+    }
+
+    while (txn->status == I2C_BUS_PENDING)
+    {
+        if ((HAL_GetTick() - start) > timeout_ms)
+        {
+            cancel(txn);
+            break;
+        }
+    }
+
+    return txn->status;
+
+}
+
+/**
+ * @brief  Hold Bus
+ * @note   Thread context only. Stops new transfers and waits for the one in flight, cancels it after
+ * 		timeout_ms. Frame direct use of the handle (bus recovery, re-init) with hold() / release()
+ * @param  uint32_t timeout_ms	:	Wait for the transfer in flight
+ * @retval None
+ */
+void I2CBus_c::hold(uint32_t timeout_ms)
+{
+
+    uint32_t start = HAL_GetTick();
+    i2c_txn_t *txn;
+
+    __disable_irq();
+    holds++;
+    __enable_irq();
+
+    while ((txn = current) != NULL)
+    {
+        if ((HAL_GetTick() - start) > timeout_ms)
+        {
+            cancel(txn);
+            break;
+        }
+    }
+
+}
+
+/**
+ * @brief  Release Bus
+ * @note   Resumes the queue after the last hold()
+ * @param  None
+ * @retval None
+ */
+void I2CBus_c::release()
+{
+
+    __disable_irq();
+    if (holds)
+    {
+        holds--;
+    }
+    start();
+    __enable_irq();
+
+}
+
+/**
+ * @brief  Get Queue Depth
+ * @note   Transactions waiting, the one in flight excluded
+ * @param  None
+ * @retval uint8_t
+ */
+uint8_t I2CBus_c::get_Depth()
+{
+
+    return stats.depth;
+
+}
+
+/**
+ * @brief  Bus Busy
+ * @note   A transfer in flight or queued, get_Depth() does not count the one in flight.
+ * 		Check it before STOP, the interrupt-driven transfer needs PCLK1
+ * @param  None
+ * @retval uint8_t	:	1 = busy
+ */
+uint8_t I2CBus_c::is_Busy()
+{
+
+    return ((current != NULL) || (stats.depth != 0)) ? 1 : 0;
+
+}
+
+/**
+ * @brief  Get Bus Statistics
+ * @note   Waits are in DWT cycles, average wait = total_wait / (transfers + coalesced)
+ * @param  None
+ * @retval const bus_stats_t &
+ */
+const I2CBus_c::bus_stats_t &I2CBus_c::get_Statistics()
+{
+
+    return stats;
+
+}
+
+/**
+ * @brief  Get I2C Handle
+ * @note   None
+ * @param  None
+ * @retval I2C_HandleTypeDef *
+ */
+I2C_HandleTypeDef *I2CBus_c::get_Handle()
+{
+
+    return hi2c;
+
+}
+
+/**
+ * @brief  Transfer Complete
+ * @note   Called from the HAL I2C callbacks, splits a coalesced read and starts the next transfer.
+ * 		The failure is classified here : the next transfer resets the handle's ErrorCode
+ * @param  uint8_t ok		:	1 = success, 0 = NACK or bus error
+ * @param  uint32_t error	:	HAL_I2C_GetError() of the failed transfer
+ * @retval None
+ */
+RAM2_FUNC void I2CBus_c::complete(uint8_t ok, uint32_t error)
+{
+
+    uint32_t primask = __get_PRIMASK();
+    i2c_txn_t *txn;
+    uint16_t offset = 0;
+
+    __disable_irq();
+    txn = current;
+    current = NULL;
+    if (txn == NULL)
+    {
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    TRACE(TRACE_BUS_DONE, ok);
+    if (ok && txn->merged)
+    {
+        for (i2c_txn_t *part = txn; part; part = part->merged)
+        {
+            memcpy(part->buf, &merge[offset], part->len);
+            offset += part->len;
+        }
+    }
+
+    if (ok)
+    {
+        finish(txn, I2C_BUS_OK);
+    }
+    else
+    {
+        finish(txn, ((error & HAL_I2C_ERROR_AF) && !(error & (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_ARLO))) ?
+                    I2C_BUS_NACK : I2C_BUS_ERROR);
+    }
+    start();
+    __set_PRIMASK(primask);
+
+}
+
+/**
+ * @brief  Cancel Transaction
+ * @note   Any context. Removes a queued transaction, or resets the peripheral when it is in flight (software
+ * 		reset through HAL_I2C_Init(), the TIMINGR value is kept). Completes with I2C_BUS_TIMEOUT, the
+ * 		descriptor belongs to the owner again on return. No-op once it completed
+ * @param  i2c_txn_t *txn
+ * @retval None
+ */
+void I2CBus_c::cancel(i2c_txn_t *txn)
+{
+
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (txn->status != I2C_BUS_PENDING)
+    {
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    for (uint8_t i = 0; i < stats.depth; i++)
+    {
+        if (queue[i] == txn)
+        {
+            remove(i);
+            finish(txn, I2C_BUS_TIMEOUT);
+            __set_PRIMASK(primask);
+            return;
+        }
+    }
+
+    txn = current;
+    current = NULL;
+    HAL_I2C_Init(hi2c);
+    if (txn)
+    {
+        finish(txn, I2C_BUS_TIMEOUT);
+    }
+    start();
+    __set_PRIMASK(primask);
+
+}
+
+/**
+ * @brief  Start Next Transfer
+ * @note   Interrupts masked. Drops expired transactions and coalesces reads of the same device that continue
+ * 		the register range at either end
+ * @param  None
+ * @retval None
+ */
+RAM2_FUNC void I2CBus_c::start()
+{
+
+    i2c_txn_t *txn;
+    i2c_txn_t *tail;
+    uint16_t total;
+    uint8_t index;
+    HAL_StatusTypeDef status;
+
+    while ((current == NULL) && (holds == 0) && (stats.depth != 0))
+    {
+        index = pick();
+        txn = queue[index];
+        remove(index);
+
+        if (txn->deadline && ((int32_t)(now_ms() - txn->deadline) > 0))
+        {
+            finish(txn, I2C_BUS_EXPIRED);
+            continue;
+        }
+        account(txn);
+
+        tail = txn;
+        total = txn->len;
+        for (uint8_t i = 0; (!txn->write) && (i < stats.depth); i++)
+        {
+            i2c_txn_t *next = queue[i];
+
+            if (next->write || (next->address != txn->address) || (total + next->len > I2C_BUS_MERGE))
+            {
+                continue;
+            }
+            if (next->reg == txn->reg + total)
+            {
+                tail->merged = next;
+                tail = next;
+            }
+            else if (next->reg + next->len == txn->reg)
+            {
+                next->merged = txn;
+                txn = next;
+            }
+            else
+            {
+                continue;
+            }
+            remove(i);
+            account(next);
+            stats.coalesced++;
+            total += next->len;
+            i = 0xFF;                   /*  Rescan, a later entry may continue the new range  */
+        }
+
+        current = txn;
+        stats.transfers++;
+        TRACE(TRACE_BUS_START, ((uint32_t)total << 16) | ((uint32_t)txn->address << 8) | txn->reg);
+        if (txn->write)
+        {
+            status = HAL_I2C_Mem_Write_IT(hi2c, txn->address, txn->reg, I2C_MEMADD_SIZE_8BIT, txn->buf, txn->len);
+        }
+        else
+        {
+            status = HAL_I2C_Mem_Read_IT(hi2c, txn->address, txn->reg, I2C_MEMADD_SIZE_8BIT,
+                                         txn->merged ? merge : txn->buf, total);
+        }
+
+        if (status != HAL_OK)
+        {
+            current = NULL;
+            finish(txn, I2C_BUS_ERROR);
+        }
+    }
+
+}
+
+/**
+ * @brief  Complete Transaction Chain
+ * @note   Interrupts masked, the callbacks may submit again
+ * @param  i2c_txn_t *txn	:	First transaction of the chain
+ * @param  uint8_t status	:	Final status
+ * @retval None
+ */
+RAM2_FUNC void I2CBus_c::finish(i2c_txn_t *txn, uint8_t status)
+{
+
+    i2c_txn_t *next;
+
+    while (txn)
+    {
+        next = txn->merged;
+        txn->merged = NULL;
+        if (status == I2C_BUS_EXPIRED)
+        {
+            stats.expired++;
+        }
+        else if (status != I2C_BUS_OK)
+        {
+            stats.errors++;
+        }
+        txn->status = status;
+        if (txn->done)
+        {
+            txn->done(txn);
+        }
+        txn = next;
+    }
+
+}
+
+/**
+ * @brief  Pick Next Transaction
+ * @note   Lowest priority value, then earliest deadline (none = last), then oldest
+ * @param  None
+ * @retval uint8_t	:	Queue index, depth must not be 0
+ */
+RAM2_FUNC uint8_t I2CBus_c::pick()
+{
+
+    uint32_t now = now_ms();
+    uint8_t best = 0;
+
+    for (uint8_t i = 1; i < stats.depth; i++)
+    {
+        i2c_txn_t *a = queue[i];
+        i2c_txn_t *b = queue[best];
+
+        if (a->priority != b->priority)
+        {
+            if (a->priority < b->priority)
+            {
+                best = i;
+            }
+        }
+        else if (a->deadline && (!b->deadline || ((a->deadline - now) < (b->deadline - now))))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+
+}
+
+/**
+ * @brief  Remove Queue Entry
+ * @note   Interrupts masked, keeps the submit order of the rest
+ * @param  uint8_t index
+ * @retval None
+ */
+RAM2_FUNC void I2CBus_c::remove(uint8_t index)
+{
+
+    stats.depth--;
+    for (uint8_t i = index; i < stats.depth; i++)
+    {
+        queue[i] = queue[i + 1];
+    }
+
+}
+
+/**
+ * @brief  Account Wait Time
+ * @note   submit() to transfer start
+ * @param  i2c_txn_t *txn
+ * @retval None
+ */
+RAM2_FUNC void I2CBus_c::account(i2c_txn_t *txn)
+{
+
+    uint32_t wait = DWT->CYCCNT - txn->stamp;
+
+    stats.last_wait = wait;
+    stats.total_wait += wait;
+    if (wait > stats.worst_wait)
+    {
+        stats.worst_wait = wait;
+    }
+
+}
+
+extern "C" RAM2_FUNC void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (bus_owner && (hi2c == bus_owner->get_Handle()))
+    {
+        bus_owner->complete(1);
+    }
+}
+
+extern "C" RAM2_FUNC void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (bus_owner && (hi2c == bus_owner->get_Handle()))
+    {
+        bus_owner->complete(1);
+    }
+}
+
+extern "C" RAM2_FUNC void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (bus_owner && (hi2c == bus_owner->get_Handle()))
+    {
+        bus_owner->complete(0, HAL_I2C_GetError(hi2c));
+    }
+}
+
+/**
+ * @brief  I2C1 Event Interrupt Function
+ * @note   Called from I2C1_EV_IRQHandler()
+ * @param  None
+ * @retval None
+ */
+extern "C" RAM2_FUNC void I2CBus_EV_IRQHandler(void)
+{
+    if (bus_owner)
+    {
+        HAL_I2C_EV_IRQHandler(bus_owner->get_Handle());
+    }
+}
+
+/**
+ * @brief  I2C1 Error Interrupt Function
+ * @note   Called from I2C1_ER_IRQHandler()
+ * @param  None
+ * @retval None
+ */
+extern "C" RAM2_FUNC void I2CBus_ER_IRQHandler(void)
+{
+    if (bus_owner)
+    {
+        HAL_I2C_ER_IRQHandler(bus_owner->get_Handle());
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Prioritized transaction queue for a shared I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _I2CBUS_HPP_
+#define _I2CBUS_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+
+#define I2C_BUS_QUEUE         16      /*  Queued transactions, the one in flight excluded          */
+#define I2C_BUS_MERGE         16      /*  Bytes of one coalesced read                              */
+
+#define I2C_BUS_PENDING       0       /*  Queued or in flight                                      */
+#define I2C_BUS_OK            1       /*  Transfer completed                                       */
+#define I2C_BUS_ERROR         2       /*  Bus error, arbitration lost, overrun or refused by the HAL  */
+#define I2C_BUS_EXPIRED       3       /*  Deadline passed before the transfer could start          */
+#define I2C_BUS_TIMEOUT       4       /*  Cancelled by the timeout of transfer() or hold()         */
+#define I2C_BUS_REJECTED      5       /*  transfer() only : queue full, nothing was sent           */
+#define I2C_BUS_NACK          6       /*  Device did not acknowledge, the bus itself is fine       */
+
+/*
+ *  Every driver on the bus describes a register access in an i2c_txn_t and submit()s it, the bus runs the
+ *  queue back to back with HAL_I2C_Mem_Read_IT / HAL_I2C_Mem_Write_IT from the completion interrupt.
+ *  The next transfer is the lowest priority value, then the earliest deadline, then the oldest.
+ *  A read is coalesced with queued reads of the same device that continue its register range at either
+ *  end, up to I2C_BUS_MERGE bytes, and every merged transaction completes on its own.
+ *
+ *  The descriptor belongs to the bus from submit() until its status leaves I2C_BUS_PENDING, the done
+ *  callback runs in interrupt context. Blocking HAL calls on the same handle must go through transfer()
+ *  or be framed by hold() / release(). The peripheral runs from PCLK1, which stops in STOP : an idle hook
+ *  must not enter STOP while is_Busy(), a transfer would freeze mid-byte until the next wake-up.
+ */
+
+typedef struct i2c_txn
+{
+  uint8_t   address;                  /*  8 bit device address                                       */
+  uint8_t   reg;                      /*  First register, the device auto-increments                 */
+  uint8_t   write;                    /*  1 = write, 0 = read                                        */
+  uint8_t   priority;                 /*  0 = highest                                                */
+  uint8_t  *buf;
+  uint16_t  len;
+  uint32_t  deadline;                 /*  Latest start in clock ms, 0 = none                         */
+  void    (*done)(struct i2c_txn *txn);   /*  Completion callback, interrupt context, NULL = poll status */
+  void     *ctx;                      /*  Owner data for the callback                                */
+  volatile uint8_t status;            /*  I2C_BUS_PENDING .. I2C_BUS_NACK                            */
+  uint32_t  stamp;                    /*  Internal : DWT->CYCCNT at submit()                         */
+  struct i2c_txn *merged;             /*  Internal : next transaction of a coalesced read            */
+} i2c_txn_t;
+
+class I2CBus_c {
+
+public:
+
+  typedef uint32_t (*clock_fn_t)(void);
+
+  typedef struct
+  {
+    uint32_t submitted;               /*  Accepted by submit()                                       */
+    uint32_t rejected;                /*  Queue full                                                 */
+    uint32_t transfers;               /*  Bus transfers started, a coalesced read counts once        */
+    uint32_t coalesced;               /*  Transactions served by another one's transfer              */
+    uint32_t errors;                  /*  Transactions completed with I2C_BUS_ERROR or I2C_BUS_NACK  */
+    uint32_t expired;                 /*  Transactions completed with I2C_BUS_EXPIRED                */
+    uint8_t  depth;                   /*  Queued now                                                 */
+    uint8_t  worst_depth;             /*  Most queued at once                                        */
+    uint32_t last_wait;               /*  submit() to transfer start, core cycles                    */
+    uint32_t worst_wait;              /*  Worst submit() to transfer start, core cycles              */
+    uint64_t total_wait;              /*  Sum of all waits, average = total_wait / started ones      */
+  }bus_stats_t;
+
+  void      Init(I2C_HandleTypeDef *hi2c, clock_fn_t now_ms);
+
+  uint8_t   submit(i2c_txn_t *txn);
+  uint8_t   transfer(i2c_txn_t *txn, uint32_t timeout_ms);
+
+  void      cancel(i2c_txn_t *txn);
+  void      hold(uint32_t timeout_ms);
+  void      release();
+
+  uint8_t   get_Depth();
+  uint8_t   is_Busy();
+  const bus_stats_t &get_Statistics();
+  I2C_HandleTypeDef *get_Handle();
+
+  void      complete(uint8_t ok, uint32_t error = 0);
+
+private:
+
+  void      start();
+  void      finish(i2c_txn_t *txn, uint8_t status);
+  uint8_t   pick();
+  void      remove(uint8_t index);
+  void      account(i2c_txn_t *txn);
+
+I2C_HandleTypeDef *hi2c = NULL;
+clock_fn_t now_ms = NULL;
+i2c_txn_t *queue[I2C_BUS_QUEUE];
+i2c_txn_t *volatile current = NULL;
+volatile uint8_t holds = 0;
+uint8_t merge[I2C_BUS_MERGE];
+bus_stats_t stats = {};
+
+};
+
+extern "C" void I2CBus_EV_IRQHandler(void);
+extern "C" void I2CBus_ER_IRQHandler(void);
+
+#endif
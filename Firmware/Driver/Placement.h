@@ -0,0 +1,46 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        SRAM2 placement of hot code and data
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _PLACEMENT_H_
+#define _PLACEMENT_H_
+
+/*
+ *  SRAM2 (0x10000000, 32 KB) runs without wait states at any clock and is fetched over the I-Code/D-Code
+ *  buses, flash needs FLASH_LATENCY_4 at 80 MHz and only the ART cache hides that. The linker scripts
+ *  collect
+ *
+ *      .ram2       RAM2_FUNC functions, RAM2_DATA objects and the HAL interrupt paths selected by input
+ *                  section in the script, stored in flash and copied by the startup before main()
+ *      .ram2_bss   RAM2_BSS objects, zeroed by the startup
+ *
+ *  Calls between flash and SRAM2 are out of BL range, the linker inserts a long branch veneer. Keep DMA
+ *  buffers out of SRAM2 : the DMA only reaches it through the 0x20018000 alias.
+ *
+ *  Example Usage
+ *
+ *	RAM2_FUNC void I2C1_EV_IRQHandler(void) { ... }
+ *	static uint8_t table[64] RAM2_DATA = { ... };
+ *	static uint8_t scratch[256] RAM2_BSS;
+ */
+
+#ifdef USE_HAL_DRIVER
+#define RAM2_FUNC             __attribute__((section(".ram2_text"), noinline))
+#define RAM2_DATA             __attribute__((section(".ram2_data")))
+#define RAM2_BSS              __attribute__((section(".ram2_bss")))
+#else
+#define RAM2_FUNC
+#define RAM2_DATA
+#define RAM2_BSS
+#endif
+
+#endif
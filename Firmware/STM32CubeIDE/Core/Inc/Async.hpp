@@ -0,0 +1,73 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Stackless async functions (protothread style) for straight-line driver sequences
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _ASYNC_HPP_
+#define _ASYNC_HPP_
+
+#include <stdint.h>
+
+/*
+ *  The toolchain is GCC 7 with -std=gnu++14, C++20 coroutines are not available. An async function is a
+ *  plain function that returns ASYNC_RUNNING until it finishes, and keeps its resume point in an async_t.
+ *  Every call resumes at the last ASYNC_AWAIT / ASYNC_CALL, so the sequence reads as straight-line code.
+ *
+ *  The frame is the 2 byte async_t owned by the caller, declare it static or as a member : no heap and no
+ *  stack is kept between resumes. Locals do not survive a suspension, keep such values in statics or
+ *  members. switch statements can not be used across a suspension point inside an async function.
+ *
+ *      uint8_t acquire(async_t *pt)
+ *      {
+ *        ASYNC_BEGIN(pt);
+ *        ASYNC_CALL(pt, &op, Sensor.read_Sample(&op, &raw));
+ *        ASYNC_AWAIT(pt, flag);
+ *        ASYNC_END(pt);
+ *      }
+ */
+
+#define ASYNC_RUNNING         0       /*  Suspended, call again after the next completion         */
+#define ASYNC_DONE            1       /*  Finished, the next call starts over                      */
+#define ASYNC_ERROR           2       /*  Aborted, the next call starts over                       */
+
+typedef struct
+{
+  uint16_t line;                      /*  Resume point, 0 = start                                   */
+} async_t;
+
+#define ASYNC_RESET(pt)             ((pt)->line = 0)
+
+#define ASYNC_BEGIN(pt)             switch ((pt)->line) { case 0:
+
+#define ASYNC_AWAIT(pt, condition)                                                  \
+    do {                                                                            \
+        (pt)->line = __LINE__; /* FALLTHRU */                                       \
+        case __LINE__:                                                              \
+        if (!(condition)) { return ASYNC_RUNNING; }                                 \
+    } while (0)
+
+#define ASYNC_CALL(pt, child, call)                                                 \
+    do {                                                                            \
+        ASYNC_RESET(child);                                                         \
+        (pt)->line = __LINE__; /* FALLTHRU */                                       \
+        case __LINE__:                                                              \
+        {                                                                           \
+            uint8_t async_result_ = (call);                                         \
+            if (async_result_ == ASYNC_RUNNING) { return ASYNC_RUNNING; }           \
+            if (async_result_ != ASYNC_DONE) { ASYNC_RESET(pt); return async_result_; } \
+        }                                                                           \
+    } while (0)
+
+#define ASYNC_EXIT(pt, result)      do { ASYNC_RESET(pt); return (result); } while (0)
+
+#define ASYNC_END(pt)               } ASYNC_RESET(pt); return ASYNC_DONE
+
+#endif
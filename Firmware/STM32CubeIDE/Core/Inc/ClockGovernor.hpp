@@ -0,0 +1,83 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Clock governor : low-power run on MSI for idle sampling, PLL 80 MHz for compute bursts
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _CLOCKGOVERNOR_HPP_
+#define _CLOCKGOVERNOR_HPP_
+
+#include <stdint.h>
+#include <main.h>
+
+#define GOVERNOR_MAX_I2C      2       /*  I2C handles retimed on every transition                 */
+#define GOVERNOR_MAX_UART     1       /*  UART handles retimed on every transition                */
+#define GOVERNOR_DRAIN_MS     30      /*  Wait for transfers in flight before a switch, > I2C_TIMEOUT_BUSY  */
+
+class I2CBus_c;
+
+/*
+ *  I2C1 is clocked from PCLK1, so every SYSCLK change rewrites TIMINGR (100 kHz standard mode, computed from
+ *  the new PCLK1). A UART on PCLK1 gets BRR recomputed by HAL_UART_Init(). Attach every handle that shares
+ *  the clock once, HDC2022_c works on the handle given to its Init().
+ *
+ *  Transfers are drained before SYSCLK / PCLK1 change, not after : a transfer running across the switch
+ *  would finish with the old TIMINGR on the new PCLK1 (LOW -> FULL : the 2 MHz timing at 80 MHz is an SCL
+ *  of several MHz). An attached I2CBus_c is held from before the switch until the new timing is written.
+ *  Call set_Mode() / request_Full() / release_Full() from thread context : the waits are bounded, with
+ *  interrupts masked nothing in flight can complete and the retime cuts it.
+ *
+ *  USART2 runs from HSI16 instead (SystemClock_Config()) : MSI 2 MHz gives BRR 17 at 115200 baud, +2.1 %,
+ *  HSI16 gives BRR 139, -0.08 %, in both modes. CLOCK_LOW therefore leaves HSI16 on, about 150 uA while
+ *  awake. STOP clears HSION, LowPower_c::restore_Clock() starts it again on an MSI wake-up.
+ */
+
+class ClockGovernor_c {
+
+public:
+
+  typedef enum
+  {
+    CLOCK_LOW = 0x00,                 /*  MSI 2 MHz, Range 2, Low-power run                          */
+    CLOCK_FULL,                       /*  HSI16 + PLL 80 MHz, Range 1 (SystemClock_Config())         */
+  }mode_t;
+
+  void      Init();
+  void      attach_I2C(I2C_HandleTypeDef *hi2c);
+  void      attach_UART(UART_HandleTypeDef *huart);
+  void      attach_Bus(I2CBus_c *bus);
+
+  void      set_Mode(mode_t mode);
+  mode_t    get_Mode();
+
+  void      request_Full();
+  void      release_Full();
+  uint32_t  get_Transitions();
+
+  static uint32_t calc_I2CTiming(uint32_t i2c_clock);
+
+private:
+
+  void      switch_Mode(mode_t mode);
+  uint8_t   drain();
+  void      retime();
+
+mode_t mode = CLOCK_FULL;
+mode_t base = CLOCK_FULL;
+uint32_t transitions = 0;
+uint8_t full_requests = 0;
+uint8_t i2c_count = 0;
+uint8_t uart_count = 0;
+I2C_HandleTypeDef *i2c[GOVERNOR_MAX_I2C];
+UART_HandleTypeDef *uart[GOVERNOR_MAX_UART];
+I2CBus_c *bus = NULL;
+
+};
+#endif
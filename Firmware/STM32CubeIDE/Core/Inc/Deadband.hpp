@@ -0,0 +1,52 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Report-on-change (deadband + heartbeat) filter for HDC2022 samples
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _DEADBAND_HPP_
+#define _DEADBAND_HPP_
+
+#include <stdint.h>
+#include <HDC2022Regs.hpp>
+
+
+class Deadband_c {
+
+public:
+
+  void      Init(float temperature_delta, float humidity_delta, uint32_t heartbeat);
+  void      Reset();
+
+  uint8_t   update(const hdc_raw_sample_t &sample, uint32_t timestamp);
+  uint8_t   update(float temperature, float humidity, uint32_t timestamp);
+
+  uint32_t  get_Suppressed();
+  uint32_t  get_SuppressedTotal();
+  uint32_t  get_Emitted();
+
+private:
+
+uint16_t temperature_delta;     /*  Minimum temperature change to report (raw code)                */
+uint16_t humidity_delta;        /*  Minimum humidity change to report (raw code)                   */
+uint32_t heartbeat;             /*  Maximum time between two reports (ms), 0 = no heartbeat        */
+
+uint16_t last_temperature;      /*  Last reported temperature (raw code)                           */
+uint16_t last_humidity;         /*  Last reported humidity (raw code)                              */
+uint32_t last_timestamp;        /*  Time of the last report                                        */
+uint8_t  primed;                /*  0 until the first sample has been reported                     */
+
+uint32_t suppressed_run;        /*  Samples suppressed since the last report                       */
+uint32_t suppressed_last;       /*  Samples suppressed right before the last report                */
+uint32_t suppressed_total;      /*  Samples suppressed since Init()/Reset()                         */
+uint32_t emitted;               /*  Samples reported since Init()/Reset()                           */
+
+};
+#endif
@@ -0,0 +1,106 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Interrupt driven async HDC2022 operations over a pluggable I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HDC2022ASYNC_HPP_
+#define _HDC2022ASYNC_HPP_
+
+#include <stdint.h>
+#include <Async.hpp>
+#include <HDC2022Regs.hpp>
+
+#ifdef USE_HAL_DRIVER
+#include <I2CBus.hpp>
+#endif
+
+#define HDC2022_RESTART_POLLS 64      /*  restart() gives up after this many SOFT_RES polls, about 7 ms of NACKs at 100 kHz  */
+
+/*
+ *  The bus only starts a transfer and reports its end through complete(), from the interrupt on the target
+ *  (an I2CBus_c transaction, see bind_Bus()) or from a simulated device on the host
+ *  (Firmware/Tools/HDC2022Sim). Everything above the bus is plain C++ and builds on both.
+ *
+ *  One operation runs at a time per object. Blocking HDC2022_c calls may run while an operation is in
+ *  flight when both are attached to the same I2CBus_c (bind_Bus() here, HDC2022_c::attach_Bus()) : the bus
+ *  queues them. An async_bus_t of Init() that drives the HAL handle directly has no such arbitration,
+ *  blocking calls on that handle must wait until the operation has completed.
+ */
+
+typedef struct
+{
+  uint8_t (*read)(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len);          /*  1 = started  */
+  uint8_t (*write)(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len);         /*  1 = started  */
+  void *ctx;
+  void (*cancel)(void *ctx);                                                     /*  Drop the transfer in flight, may complete(0) it, NULL = none  */
+} async_bus_t;
+
+class HDC2022Async_c {
+
+public:
+
+  typedef hdc_raw_sample_t raw_sample_t;
+  typedef hdc_peak_sample_t peak_sample_t;
+
+  typedef struct
+  {
+    uint32_t operations;              /*  Completed operations                                       */
+    uint32_t errors;                  /*  Refused starts and failed transfers                        */
+  }async_stats_t;
+
+  void      Init(const async_bus_t *bus);
+  void      set_Notify(void (*notify)(void));
+  void      complete(uint8_t ok);
+  void      abort();
+
+  uint8_t   read_Sample(async_t *pt, raw_sample_t *sample);
+  uint8_t   read_Status(async_t *pt, uint8_t *status);
+  uint8_t   read_Peaks(async_t *pt, peak_sample_t *peaks);
+  uint8_t   trigger_Measurement(async_t *pt, uint8_t configuration);
+  uint8_t   restart(async_t *pt, const uint8_t *configuration);
+
+  const async_stats_t &get_Statistics();
+
+#ifdef USE_HAL_DRIVER
+  void      bind_Bus(I2CBus_c *i2c_bus, uint8_t address, uint8_t priority);
+#endif
+
+private:
+
+  uint8_t   transfer(uint8_t reg, uint16_t len, uint8_t write, uint8_t *data = 0);
+
+#ifdef USE_HAL_DRIVER
+  static uint8_t bus_Read(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len);
+  static uint8_t bus_Write(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len);
+  static uint8_t bus_Submit(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len, uint8_t write);
+  static void    bus_Done(i2c_txn_t *txn);
+  static void    bus_Cancel(void *ctx);
+#endif
+
+const async_bus_t *bus = 0;
+void (*notify)(void) = 0;
+volatile uint8_t done = 0;
+volatile uint8_t ok = 0;
+async_t xfer = {0};
+uint8_t buffer[7];                    /*  TEMPERATURE_LOW .. HUMIDITY_MAX                            */
+uint8_t polls = 0;                    /*  restart() : SOFT_RES polls so far                          */
+uint8_t poll_result = ASYNC_RUNNING;
+async_stats_t stats = {};
+
+#ifdef USE_HAL_DRIVER
+I2CBus_c *shared_bus = 0;             /*  bind_Bus() : one transaction per object, ctx = this        */
+i2c_txn_t bus_txn = {};
+async_bus_t bus_binding = {};
+#endif
+
+};
+
+#endif
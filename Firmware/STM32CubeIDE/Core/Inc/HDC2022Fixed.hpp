@@ -0,0 +1,217 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        HDC2022 driver for one fixed configuration chosen at compile time
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HDC2022FIXED_HPP_
+#define _HDC2022FIXED_HPP_
+
+#include <stdint.h>
+#include <HDC2022.hpp>
+#include <HDC2022Regs.hpp>
+
+/*
+ *  Use this when the sensor runs in one configuration for its whole life. Resolution, mode, DRDY use and
+ *  result format are template parameters. The 9 configuration registers are a constexpr table written
+ *  in one transaction. Nothing is kept in RAM besides the handle, and only the members an application
+ *  calls are compiled, so there are no shadows, retries, bus recovery, alarms or float code unless
+ *  asked for. Use HDC2022_c for run-time reconfiguration, alarms, shared I2CBus_c operation and recovery.
+ *
+ *  Example Usage
+ *
+ *	typedef HDC2022Fixed_c<HDC2022_c::RATE_1HZ, HDC_RES_14BIT, HDC_CH_BOTH, 1, HDC_FORMAT_CENTI> Sensor_t;
+ *	Sensor_t Sensor;
+ *	Sensor_t::sample_t sample;
+ *
+ *	Sensor.Init(hi2c1, 10);
+ *	...on DRDY :
+ *	if (Sensor.read_Sample(sample) == HAL_OK) { sample.temperature ... 0.01 °C }
+ */
+
+typedef enum
+{
+  HDC_RES_14BIT = 0x00,               /*  TACC / HACC codes                                          */
+  HDC_RES_11BIT,
+  HDC_RES_9BIT,
+}hdc_resolution_t;
+
+typedef enum
+{
+  HDC_CH_BOTH = 0x00,                 /*  MEAS_CONF codes : humidity + temperature                   */
+  HDC_CH_TEMPERATURE,                 /*  Temperature only, humidity is not read                     */
+}hdc_channels_t;
+
+typedef enum
+{
+  HDC_FORMAT_RAW = 0x00,              /*  uint16_t register codes                                    */
+  HDC_FORMAT_CENTI,                   /*  int32_t 0.01 °C / 0.01 %RH, integer only                   */
+  HDC_FORMAT_FLOAT,                   /*  float °C / %RH                                             */
+}hdc_format_t;
+
+template<hdc_format_t FORMAT>
+struct hdc_format_traits_t;
+
+template<>
+struct hdc_format_traits_t<HDC_FORMAT_RAW>
+{
+  typedef uint16_t value_t;
+  static value_t temperature(uint16_t code)   { return code; }
+  static value_t humidity(uint16_t code)      { return code; }
+};
+
+template<>
+struct hdc_format_traits_t<HDC_FORMAT_CENTI>
+{
+  typedef int32_t value_t;
+  static value_t temperature(uint16_t code)   { return (int32_t)(((uint32_t)code * 16500U) >> 16) - 4000; }
+  static value_t humidity(uint16_t code)      { return (int32_t)(((uint32_t)code * 10000U) >> 16); }
+};
+
+template<>
+struct hdc_format_traits_t<HDC_FORMAT_FLOAT>
+{
+  typedef float value_t;
+  static value_t temperature(uint16_t code)   { return HDC2022_c::decode_Temperature(code); }
+  static value_t humidity(uint16_t code)      { return HDC2022_c::decode_Humidity(code); }
+};
+
+template<HDC2022_c::rate_t RATE, hdc_resolution_t RESOLUTION, hdc_channels_t CHANNELS, uint8_t DRDY, hdc_format_t FORMAT>
+class HDC2022Fixed_c {
+
+public:
+
+  typedef typename hdc_format_traits_t<FORMAT>::value_t value_t;
+
+  typedef struct
+  {
+    value_t temperature;
+    value_t humidity;                 /*  Not updated with HDC_CH_TEMPERATURE                         */
+  }sample_t;
+
+  static_assert((RESOLUTION <= HDC_RES_9BIT) && (CHANNELS <= HDC_CH_TEMPERATURE) && (DRDY <= 1),
+                "HDC2022Fixed_c : configuration out of range");
+
+  /*  Register values, all folded at compile time from HDC2022Map  */
+  static constexpr uint8_t interrupt_enable = HDC2022Map::INTERRUPT_ENABLE::DRDY_ENABLE::value(DRDY).apply(0);
+
+  static constexpr uint8_t device_configuration =
+      (HDC2022Map::DEVICE_CONFIGURATION::CC::value(RATE) | HDC2022Map::DEVICE_CONFIGURATION::INT_POL::value(1) |
+       HDC2022Map::DEVICE_CONFIGURATION::DRDY_INT_EN::value(DRDY)).apply(0);
+
+  static constexpr uint8_t measurement_configuration =
+      (HDC2022Map::MEASUREMENT_CONFIGURATION::TACC::value(RESOLUTION) |
+       HDC2022Map::MEASUREMENT_CONFIGURATION::HACC::value(RESOLUTION) |
+       HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_CONF::value(CHANNELS)).apply(0);
+
+  static constexpr uint8_t sample_length = (CHANNELS == HDC_CH_BOTH) ? 4 : 2;
+
+  /*  Register pointer, then INTERRUPT_ENABLE .. MEASUREMENT_CONFIGURATION. Auto mode starts with this write  */
+  static constexpr uint8_t init_table[10] =
+  {
+      HDC2022Map::INTERRUPT_ENABLE::address,
+      interrupt_enable,
+      HDC2022Map::TEMP_OFFSET_ADJUST::reset,
+      HDC2022Map::HUM_OFFSET_ADJUST::reset,
+      HDC2022Map::TEMP_THR_L::reset,
+      HDC2022Map::TEMP_THR_H::reset,
+      HDC2022Map::RH_THR_L::reset,
+      HDC2022Map::RH_THR_H::reset,
+      device_configuration,
+      HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(measurement_configuration, RATE != HDC2022_c::RATE_ONE_SHOT),
+  };
+
+  /**
+   * @brief  Fixed Configuration Initialization Function
+   * @note	Writes init_table in one transaction
+   * @param  I2C_HandleTypeDef &I2C_Handler	:	Owned by the application
+   * @param  uint8_t timeout				:	Per transaction (ms)
+   * @param  uint8_t address				:	0x40<<1 (ADDR pin low) or 0x41<<1
+   * @retval HAL_StatusTypeDef
+   */
+  HAL_StatusTypeDef Init(I2C_HandleTypeDef &I2C_Handler, uint8_t timeout, uint8_t address = 0x40<<1)
+  {
+      i2c = &I2C_Handler;
+      i2c_timeout = timeout;
+      DeviceID = address;
+
+      return HAL_I2C_Master_Transmit(i2c, DeviceID, const_cast<uint8_t *>(init_table), sizeof(init_table), i2c_timeout);
+  }
+
+  /**
+   * @brief  Read Sample
+   * @note	One burst from TEMPERATURE_LOW, 4 bytes or 2 with HDC_CH_TEMPERATURE. Also clears DRDY
+   * @param  sample_t &sample	:	Left unchanged on error
+   * @retval HAL_StatusTypeDef
+   */
+  HAL_StatusTypeDef read_Sample(sample_t &sample)
+  {
+      uint8_t data[sample_length];
+      HAL_StatusTypeDef status = read(HDC2022Map::TEMPERATURE_LOW::address, data, sample_length);
+
+      if (status == HAL_OK)
+      {
+          sample.temperature = hdc_format_traits_t<FORMAT>::temperature((uint16_t)((data[1] << 8) | data[0]));
+          if (CHANNELS == HDC_CH_BOTH)
+          {
+              sample.humidity = hdc_format_traits_t<FORMAT>::humidity((uint16_t)((data[sample_length - 1] << 8) | data[sample_length - 2]));
+          }
+      }
+      return status;
+  }
+
+  /**
+   * @brief  Data Ready
+   * @note	STATUS read, for builds polling instead of using the DRDY pin
+   * @param  None
+   * @retval uint8_t	:	1 = new sample, 0 = none or bus error
+   */
+  uint8_t data_Ready()
+  {
+      uint8_t status = 0;
+
+      read(HDC2022Map::STATUS::address, &status, 1);
+      return HDC2022Map::STATUS::DRDY_STATUS::get(status);
+  }
+
+  /**
+   * @brief  Trigger Measurement
+   * @note	One-shot configurations only, auto mode is started by Init()
+   * @param  None
+   * @retval HAL_StatusTypeDef
+   */
+  HAL_StatusTypeDef trigger_Measurement()
+  {
+      static_assert(RATE == HDC2022_c::RATE_ONE_SHOT, "HDC2022Fixed_c : auto mode runs without triggers");
+      uint8_t command[2] = { HDC2022Map::MEASUREMENT_CONFIGURATION::address,
+                             HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(measurement_configuration, 1) };
+
+      return HAL_I2C_Master_Transmit(i2c, DeviceID, command, sizeof(command), i2c_timeout);
+  }
+
+private:
+
+I2C_HandleTypeDef *i2c = NULL;
+uint8_t DeviceID = 0x40<<1;
+uint8_t i2c_timeout = 10;
+
+  HAL_StatusTypeDef read(uint8_t reg, uint8_t *data, uint16_t len)
+  {
+      HAL_StatusTypeDef status = HAL_I2C_Master_Transmit(i2c, DeviceID, &reg, 1, i2c_timeout);
+
+      return (status == HAL_OK) ? HAL_I2C_Master_Receive(i2c, DeviceID, data, len, i2c_timeout) : status;
+  }
+
+};
+
+template<HDC2022_c::rate_t RATE, hdc_resolution_t RESOLUTION, hdc_channels_t CHANNELS, uint8_t DRDY, hdc_format_t FORMAT>
+constexpr uint8_t HDC2022Fixed_c<RATE, RESOLUTION, CHANNELS, DRDY, FORMAT>::init_table[10];
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Optional FreeRTOS adapter : shared HDC2022 bus with task notifications
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HDC2022RTOS_HPP_
+#define _HDC2022RTOS_HPP_
+
+/*
+ *  Built only with -DHDC2022_USE_FREERTOS, FreeRTOS itself is not part of this project. Needs FreeRTOS
+ *  V10.4 or later with configSUPPORT_STATIC_ALLOCATION = 1, configUSE_TASK_NOTIFICATIONS = 1 and
+ *  configTASK_NOTIFICATION_ARRAY_ENTRIES > HDC2022_RTOS_NOTIFY_INDEX. USE_RTOS in stm32l4xx_hal_conf.h
+ *  stays 0, the HAL blocking calls are not used on this path.
+ *
+ *  One bus task owns the HDC2022Async_c object. Client tasks put a request in its queue and block on a
+ *  direct-to-task notification of their own index (HDC2022_RTOS_NOTIFY_INDEX, not the index 0 the
+ *  application may use) until the bus task marks the request done : the request lives on the client's
+ *  stack, the client never returns while the bus task may still write it. The bus task itself sleeps on a
+ *  notification given from the I2C completion interrupt, so other tasks run while the bus is busy.
+ *  Requests are served in queue order, every transfer is bounded by the timeout given to Init().
+ *
+ *  With the FreeRTOS POSIX/Linux port the same file runs over the simulated bus of Firmware/Tools/HDC2022Sim,
+ *  complete() may then be called from a task as well as from an interrupt.
+ */
+
+#ifdef HDC2022_USE_FREERTOS
+
+#include <stdint.h>
+#include <stddef.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <HDC2022Async.hpp>
+
+#ifndef HDC2022_RTOS_STACK
+#define HDC2022_RTOS_STACK        256     /*  Bus task stack (words), the POSIX port needs PTHREAD_STACK_MIN */
+#endif
+#define HDC2022_RTOS_QUEUE        8       /*  Pending requests                                      */
+#ifndef HDC2022_RTOS_NOTIFY_INDEX
+#define HDC2022_RTOS_NOTIFY_INDEX 1       /*  Client task notification index reserved for the answer */
+#endif
+
+#if (HDC2022_RTOS_NOTIFY_INDEX < 1) || (HDC2022_RTOS_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES)
+#error "HDC2022Rtos : HDC2022_RTOS_NOTIFY_INDEX needs configTASK_NOTIFICATION_ARRAY_ENTRIES above it, index 0 is the application's"
+#endif
+
+class HDC2022Rtos_c {
+
+public:
+
+  uint8_t   Init(HDC2022Async_c *sensor, UBaseType_t priority, TickType_t transfer_timeout);
+
+  uint8_t   read_Sample(HDC2022Async_c::raw_sample_t *sample);
+  uint8_t   read_Status(uint8_t *status);
+  uint8_t   trigger_Measurement(uint8_t configuration);
+
+  uint32_t  get_Timeouts();
+
+};
+
+#endif
+#endif
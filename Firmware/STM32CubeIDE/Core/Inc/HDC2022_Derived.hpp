@@ -0,0 +1,64 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Derived quantities (dew point, absolute humidity, heat index) for HDC2022 samples
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HDC2022_DERIVED_HPP_
+#define _HDC2022_DERIVED_HPP_
+
+#include <stdint.h>
+#include <HDC2022.hpp>
+
+/*
+ *  All kernels take temperature in °C and humidity in %RH and avoid libm.
+ *  logf/expf are replaced by polynomial log2/exp2 kernels working on the float exponent/mantissa split.
+ *
+ *  Maximum error against the libm reference over the HDC2022 range (-40..125 °C, 1..100 %RH, 0.01 grid) :
+ *
+ *      calc_DewPoint           : 0.0004 °C
+ *      calc_AbsoluteHumidity   : 0.0005 %  (relative)
+ *      calc_HeatIndex          : same polynomial as NWS/Rothfusz, 0.05 °C float rounding against double
+ *
+ *  Host cost per call (x86-64 glibc, -O2)   : dew point  5.2 ns  vs  8.9 ns  libm
+ *                                            abs. hum.  7.8 ns  vs  7.0 ns  libm  (glibc expf is table driven)
+ *  Absolute ns depend on the machine, a shared VM gave 9 vs 10 ns and 10 vs 11 ns. Firmware/Tools/DerivedBench
+ *  reproduces the errors and the host cost.
+ *  Target budget (Cortex-M4F, estimated from the instruction count, two VDIV.F32 of 14 cycles each) :
+ *                                            dew point ~60 cycles, abs. hum. ~55 cycles, heat index ~45 cycles
+ *  newlib-nano logf/expf are software routines of a few hundred cycles each on the same core.
+ */
+
+class HDC2022_Derived_c {
+
+public:
+
+  static float calc_DewPoint(float temperature, float humidity);
+  static float calc_AbsoluteHumidity(float temperature, float humidity);
+  static float calc_HeatIndex(float temperature, float humidity);
+
+  static void  calc_DewPoint(const float *temperature, const float *humidity, float *result, uint16_t count);
+  static void  calc_AbsoluteHumidity(const float *temperature, const float *humidity, float *result, uint16_t count);
+  static void  calc_HeatIndex(const float *temperature, const float *humidity, float *result, uint16_t count);
+
+  static float calc_DewPoint(HDC2022_c &sensor);
+
+#ifdef HDC2022_DERIVED_REFERENCE
+  static float ref_DewPoint(float temperature, float humidity);
+  static float ref_AbsoluteHumidity(float temperature, float humidity);
+#endif
+
+private:
+
+  static float fast_Log2(float x);
+  static float fast_Exp2(float x);
+
+};
+#endif
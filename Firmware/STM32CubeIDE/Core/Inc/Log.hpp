@@ -0,0 +1,162 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Non-blocking log backend : lock-free ring drained by USART2 TX DMA
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _LOG_HPP_
+#define _LOG_HPP_
+
+#include <stdint.h>
+#include <string.h>
+#include <main.h>
+
+#define LOG_BUFFER            1024    /*  Ring size in bytes, power of two, at most 32768          */
+#define LOG_RECORD_MARK       0xFE    /*  Deferred record, format address ID                       */
+#define LOG_TOKEN32_MARK      0xFD    /*  Tokenized record, 32 bit token                           */
+#define LOG_TOKEN16_MARK      0xFC    /*  Tokenized record, 16 bit token                           */
+#define LOG_MAX_ARGS          8       /*  Arguments of one record                                  */
+
+#ifndef LOG_TOKEN_BITS
+#define LOG_TOKEN_BITS        32      /*  16 saves 2 bytes per record, collisions are reported by the decoder  */
+#endif
+
+/*
+ *  _write() is overridden here, so printf() / puts() only copy into the ring and return. Any context may
+ *  write : space is reserved with LDREX/STREX on one state word (head + active writers), the data becomes
+ *  visible to the DMA once the last concurrent writer has committed. The DMA sends straight from the ring,
+ *  a wrapped region goes out as two transfers. A full ring drops the write and counts the bytes.
+ *
+ *  Deferred records skip the formatting on the target : LOG_DEFERRED(format, args...) writes
+ *
+ *      LOG_RECORD_MARK, word count, format address, one 32 bit word per argument   (little endian)
+ *
+ *  The format literal stays in flash and its address is the ID, Firmware/Tools/LogDecoder reads it back
+ *  from the ELF of the same build. Integers, pointers and char are sent as 32 bit, float and double as
+ *  IEEE single, %s only resolves strings that live in the ELF image. 64 bit arguments do not compile.
+ *  %T / %H take a raw HDC2022 temperature / humidity code and print it as °C / %RH on the host, so samples
+ *  are logged without float math on the target (deferred and tokenized records only, not printf()).
+ *
+ *  Tokenized records go one step further : LOG_TOKEN(format, args...) hashes the literal at compile time
+ *  (FNV-1a) and writes
+ *
+ *      LOG_TOKEN32_MARK / LOG_TOKEN16_MARK, word count, token (4 / 2 bytes), arguments
+ *
+ *  The literal only goes to the .log_tokens section as { token, length, text }, which the linker script
+ *  keeps in the ELF as an INFO section : no flash is used and the token does not change between builds
+ *  while the text stays the same.
+ *
+ *  TX DMA : DMA1 Channel 7, request 2. USART2 keeps running in Sleep, not in STOP, the idle hook should not
+ *  enter STOP while get_Pending() is not 0.
+ */
+
+class Log_c {
+
+public:
+
+  typedef struct
+  {
+    uint32_t written;                 /*  Bytes accepted into the ring                               */
+    uint32_t dropped;                 /*  Bytes dropped, ring full                                   */
+    uint32_t records;                 /*  Deferred records accepted                                  */
+    uint32_t transfers;               /*  DMA transfers started                                      */
+    uint16_t worst_pending;           /*  Most bytes waiting in the ring                             */
+    uint32_t last_record_cycles;      /*  Reserve + copy of the last record, DWT cycles (DWT enabled elsewhere) */
+    uint32_t worst_record_cycles;     /*  Worst reserve + copy of one record, DWT cycles             */
+  }log_stats_t;
+
+  void      Init(UART_HandleTypeDef *huart);
+
+  int       write(const char *data, int len);
+  uint16_t  get_Pending();
+  uint8_t   flush(uint32_t timeout_ms);
+  const log_stats_t &get_Statistics();
+  UART_HandleTypeDef *get_Handle();
+
+  template<typename... Args>
+  void      deferred(const char *format, Args... args)
+  {
+      static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "LOG_DEFERRED : too many arguments");
+      uint32_t words[sizeof...(Args) + 1] = { (uint32_t)(uintptr_t)format, pack(args)... };
+
+      write_Record(LOG_RECORD_MARK, words, sizeof...(Args) + 1, 4);
+  }
+
+  template<typename... Args>
+  void      tokenized(uint32_t token, Args... args)
+  {
+      static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "LOG_TOKEN : too many arguments");
+      uint32_t words[sizeof...(Args) + 1] = { token, pack(args)... };
+
+#if LOG_TOKEN_BITS == 16
+      write_Record(LOG_TOKEN16_MARK, words, sizeof...(Args) + 1, 2);
+#else
+      write_Record(LOG_TOKEN32_MARK, words, sizeof...(Args) + 1, 4);
+#endif
+  }
+
+  static constexpr uint32_t hash(const char *text, uint32_t value = 2166136261UL)
+  {
+      return *text ? hash(text + 1, (value ^ (uint8_t)*text) * 16777619UL) : value;
+  }
+
+  static constexpr uint32_t token(const char *text)
+  {
+      return (LOG_TOKEN_BITS == 16) ? ((hash(text) ^ (hash(text) >> 16)) & 0xFFFF) : hash(text);
+  }
+
+  void      tx_Complete();
+
+private:
+
+  static uint32_t pack(float value)   { uint32_t word; memcpy(&word, &value, 4); return word; }
+  static uint32_t pack(double value)  { return pack((float)value); }
+  template<typename T>
+  static uint32_t pack(T *value)      { return (uint32_t)(uintptr_t)value; }
+  template<typename T>
+  static uint32_t pack(T value)
+  {
+      static_assert(sizeof(T) <= 4, "LOG_DEFERRED / LOG_TOKEN : 64 bit argument, log it as two 32 bit words");
+      return (uint32_t)value;
+  }
+
+  int32_t   reserve(uint16_t len);
+  void      commit();
+  void      copy(uint16_t at, const uint8_t *data, uint16_t len);
+  void      write_Record(uint8_t mark, const uint32_t *words, uint8_t count, uint8_t id_bytes);
+  void      kick();
+
+UART_HandleTypeDef *huart = NULL;
+volatile uint32_t state = 0;          /*  [15:0] head, [23:16] writers between reserve() and commit() */
+volatile uint16_t tail = 0;
+volatile uint16_t tx_len = 0;
+volatile uint32_t tx_busy = 0;
+uint8_t buffer[LOG_BUFFER];
+log_stats_t stats = {};
+
+};
+
+extern Log_c Log;
+
+#define LOG_DEFERRED(format, ...)   Log.deferred(format, ##__VA_ARGS__)
+
+#define LOG_TOKEN(format, ...)                                                                      \
+    do {                                                                                            \
+        static const struct { uint32_t token; uint32_t length; char text[sizeof(format)]; }         \
+            log_entry_ __attribute__((section(".log_tokens"), used, aligned(4))) =                  \
+            { Log_c::token(format), sizeof(format), format };                                       \
+        constexpr uint32_t log_token_ = Log_c::token(format);                                       \
+        Log.tokenized(log_token_, ##__VA_ARGS__);                                                   \
+    } while (0)
+
+extern "C" void Log_DMA_IRQHandler(void);
+extern "C" void Log_UART_IRQHandler(void);
+
+#endif
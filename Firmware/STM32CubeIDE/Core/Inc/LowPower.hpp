@@ -0,0 +1,64 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        STOP2 acquisition runtime, wake-up on HDC2022 DRDY (EXTI) or LPTIM1 deadline
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _LOWPOWER_HPP_
+#define _LOWPOWER_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+#include <Sampler.hpp>
+
+/*
+ *  The deadline is a one-shot wake-up on the Sampler_c timebase (LPTIM1 from LSI), which keeps counting in
+ *  STOP2. Sampling grid, scheduler clock and deadline share the one timer, sleep() always enters STOP2.
+ *
+ *  Wake-up uses HSI16 (STOPWUCK) so the core runs immediately, restore_Clock() then re-locks the PLL that
+ *  keeps its configuration through STOP2. Voltage scaling and flash latency are retained as well.
+ *  Under ClockGovernor_c::CLOCK_LOW the wake-up clock is MSI and Low-power run is left around STOP2,
+ *  restore_Clock() only restarts HSI16, the USART2 kernel clock.
+ */
+
+class LowPower_c {
+
+public:
+
+  typedef struct
+  {
+    uint32_t wakeups;                 /*  STOP2 exits                                                */
+    uint32_t deadline_wakeups;        /*  Exits caused by the deadline                               */
+    uint32_t samples;                 /*  mark_Sample() calls                                        */
+    uint32_t last_latency;            /*  Wake to sample complete, core cycles                       */
+    uint32_t worst_latency;           /*  Worst wake to sample complete, core cycles                 */
+    uint64_t awake_cycles;            /*  Total core cycles spent awake between two sleep() calls    */
+  }lp_stats_t;
+
+  void      Init(Sampler_c *timebase);
+  void      set_Deadline(uint16_t ms);
+  void      sleep();
+  void      mark_Sample();
+
+  uint32_t  get_DutyCycle(uint32_t period_ms);
+  const lp_stats_t &get_Statistics();
+
+private:
+
+  void      restore_Clock();
+
+Sampler_c *timebase;
+uint32_t wake_stamp;
+lp_stats_t stats = {};
+
+};
+
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Static allocation : typed object pools and arenas, no heap
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _POOL_HPP_
+#define _POOL_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <Placement.h>
+
+#ifdef USE_HAL_DRIVER
+#include <main.h>
+#endif
+
+/*
+ *  Pool_c<T, N> hands out N fixed slots of T, Arena_c<SIZE> hands out aligned blocks from one buffer and
+ *  frees them all at once (reset() or rewind() to a mark). Both are fully usable from their all-zero state :
+ *  no constructor has to run, so they may live in .bss or in SRAM2 (RAM2_BSS, zeroed by the startup)
+ *  and may be used before the static constructors. alloc() / free() mask interrupts for a few cycles
+ *  and may be called from any context, a failed allocation returns NULL and is counted.
+ *
+ *  With SYSMEM_HEAP_TRAP set (main.h) _sbrk() traps on its first call, so malloc / new / newlib stdio
+ *  buffers can not slip in unnoticed next to these.
+ *
+ *  Example Usage
+ *
+ *	static Pool_c<i2c_txn_t, 8> txn_pool RAM2_BSS;
+ *	static Arena_c<512> frames;
+ *
+ *	i2c_txn_t *txn = txn_pool.create();			// value-initialized, NULL when all 8 are in use
+ *	txn_pool.destroy(txn);
+ *	uint8_t *scratch = (uint8_t *)frames.alloc(64);
+ *	frames.reset();
+ */
+
+typedef struct
+{
+  uint32_t allocs;                    /*  Successful allocations                                     */
+  uint32_t failures;                  /*  Allocations refused, pool or arena exhausted               */
+  uint32_t invalid;                   /*  free() of a slot that is not allocated, ignored            */
+  uint32_t in_use;                    /*  Slots / bytes in use                                       */
+  uint32_t worst_in_use;              /*  High watermark of in_use                                   */
+}pool_stats_t;
+
+class PoolLock_c {
+
+public:
+
+  PoolLock_c()
+  {
+#ifdef USE_HAL_DRIVER
+      primask = __get_PRIMASK();
+      __disable_irq();
+#endif
+  }
+
+  ~PoolLock_c()
+  {
+#ifdef USE_HAL_DRIVER
+      __set_PRIMASK(primask);
+#endif
+  }
+
+private:
+
+uint32_t primask = 0;
+
+};
+
+template<typename T, uint16_t N>
+class Pool_c {
+
+public:
+
+  /**
+   * @brief  Allocate Slot
+   * @note   Uninitialized storage for one T, a freed slot first, then a never used one
+   * @param  None
+   * @retval T *	:	NULL = pool exhausted
+   */
+  T *alloc()
+  {
+      PoolLock_c lock;
+      slot_t *slot = head;
+
+      if (slot != NULL)
+      {
+          head = slot->next;
+      }
+      else if (fresh < N)
+      {
+          slot = &slots[fresh++];
+      }
+      else
+      {
+          stats.failures++;
+          return NULL;
+      }
+
+      live[word_Of(slot)] |= bit_Of(slot);
+      stats.allocs++;
+      if (++stats.in_use > stats.worst_in_use)
+      {
+          stats.worst_in_use = stats.in_use;
+      }
+      return reinterpret_cast<T *>(slot->storage);
+  }
+
+  /**
+   * @brief  Free Slot
+   * @note   The destructor is not called, see destroy(). NULL is ignored, a slot that is not allocated
+   * 		(double free, foreign pointer, never handed out) is counted in invalid and left alone
+   * @param  T *object	:	Pointer returned by alloc()
+   * @retval None
+   */
+  void free(T *object)
+  {
+      slot_t *slot = reinterpret_cast<slot_t *>(object);
+
+      if (object == NULL)
+      {
+          return;
+      }
+
+      PoolLock_c lock;
+
+      if (!owns(object) || !(live[word_Of(slot)] & bit_Of(slot)))
+      {
+          stats.invalid++;
+          return;
+      }
+      live[word_Of(slot)] &= ~bit_Of(slot);
+      slot->next = head;
+      head = slot;
+      stats.in_use--;
+  }
+
+  template<typename... Args>
+  T *create(Args... args)
+  {
+      void *storage = alloc();
+
+      return (storage != NULL) ? new (storage) T(args...) : NULL;
+  }
+
+  void destroy(T *object)
+  {
+      if (object != NULL)
+      {
+          object->~T();
+          free(object);
+      }
+  }
+
+  /*  Start of a slot that was handed out at least once, allocated or freed  */
+  uint8_t owns(const void *object)
+  {
+      const uint8_t *at = static_cast<const uint8_t *>(object);
+      const uint8_t *first = reinterpret_cast<const uint8_t *>(&slots[0]);
+
+      return (at >= first) && (at < first + fresh * sizeof(slot_t)) && (((at - first) % sizeof(slot_t)) == 0);
+  }
+
+  uint16_t get_Free()                         { return (uint16_t)(N - stats.in_use); }
+  const pool_stats_t &get_Statistics()        { return stats; }
+
+private:
+
+  union slot_t
+  {
+    slot_t *next;
+    alignas(T) uint8_t storage[sizeof(T)];
+  };
+
+  uint16_t word_Of(const slot_t *slot)        { return (uint16_t)((slot - slots) >> 5); }
+  uint32_t bit_Of(const slot_t *slot)         { return 1UL << ((slot - slots) & 31); }
+
+slot_t slots[N];
+slot_t *head;                         /*  Freed slots, NULL = none                                   */
+uint16_t fresh;                       /*  Slots never handed out start here                          */
+uint32_t live[(N + 31) / 32];         /*  One bit per slot, 1 = allocated                            */
+pool_stats_t stats;
+
+};
+
+template<uint32_t SIZE>
+class Arena_c {
+
+public:
+
+  /**
+   * @brief  Allocate Block
+   * @note   Bump allocation, blocks are only released together by reset() or rewind()
+   * @param  uint32_t size
+   * @param  uint32_t align	:	Power of two
+   * @retval void *			:	NULL = arena exhausted
+   */
+  void *alloc(uint32_t size, uint32_t align = 8)
+  {
+      PoolLock_c lock;
+      uint32_t at = (used + (align - 1)) & ~(align - 1);
+
+      if ((at > SIZE) || (size > SIZE - at))
+      {
+          stats.failures++;
+          return NULL;
+      }
+
+      used = at + size;
+      stats.allocs++;
+      stats.in_use = used;
+      if (used > stats.worst_in_use)
+      {
+          stats.worst_in_use = used;
+      }
+      return &buffer[at];
+  }
+
+  template<typename T, typename... Args>
+  T *create(Args... args)
+  {
+      void *storage = alloc(sizeof(T), alignof(T));
+
+      return (storage != NULL) ? new (storage) T(args...) : NULL;
+  }
+
+  uint32_t  get_Mark()                        { return used; }
+  void      rewind(uint32_t mark)             { PoolLock_c lock; if (mark < used) { used = mark; stats.in_use = mark; } }
+  void      reset()                           { rewind(0); }
+  uint32_t  get_Free()                        { return SIZE - used; }
+  const pool_stats_t &get_Statistics()        { return stats; }
+
+private:
+
+alignas(8) uint8_t buffer[SIZE];
+uint32_t used;
+pool_stats_t stats;
+
+};
+
+#endif
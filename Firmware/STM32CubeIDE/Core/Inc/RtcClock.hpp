@@ -0,0 +1,65 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        RTC wall-clock timestamp service, LSE backed, 1/256 s sub-second field
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _RTCCLOCK_HPP_
+#define _RTCCLOCK_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+
+#define RTC_PREDIV_A          127U    /*  32768 / 128 = 256 Hz, ck_apre                            */
+#define RTC_PREDIV_S          255U    /*  256 / 256 = 1 Hz, ck_spre, SSR resolution 3.9 ms         */
+
+/*
+ *  The RTC HAL is not part of this project, the peripheral is programmed through its registers.
+ *
+ *  The calendar lives in the backup domain and keeps counting through STOP modes and resets, Init() only
+ *  programs it when INITS is clear. Shadow registers are bypassed (BYPSHAD), so a read right after a STOP
+ *  exit does not wait for RSF. The registers are read until two passes agree instead.
+ *
+ *  get_Timestamp() converts to Unix time from the cached midnight of the current date, the full calendar
+ *  decode only runs once per day.
+ *
+ *  A calendar that was never set reads 2000-01-01. Init() seeds it with the time given, e.g. the build
+ *  time from parse_BuildTime(), set_Time() corrects it later from an exact source.
+ */
+
+class RtcClock_c {
+
+public:
+
+  typedef struct
+  {
+    uint32_t seconds;                 /*  Unix time (s), 2000..2099                                  */
+    uint16_t subseconds;              /*  1/256 s, 0..255                                            */
+  }rtc_stamp_t;
+
+  uint8_t   Init(uint32_t seed_seconds);
+  uint8_t   set_Time(uint32_t unix_seconds);
+
+  rtc_stamp_t get_Timestamp();
+  uint64_t  get_Milliseconds();
+
+  static uint32_t days_FromCivil(uint32_t year, uint32_t month, uint32_t day);
+  static void     civil_FromDays(uint32_t days, uint32_t *year, uint32_t *month, uint32_t *day);
+  static uint32_t decode_Time(uint32_t tr);
+  static uint32_t decode_Date(uint32_t dr);
+  static uint32_t parse_BuildTime(const char *date, const char *time);
+
+private:
+
+uint32_t cache_dr = 0xFFFFFFFF;
+uint32_t cache_midnight = 0;
+
+};
+#endif
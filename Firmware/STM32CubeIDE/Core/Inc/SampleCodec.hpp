@@ -0,0 +1,93 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Streaming time-series codec for HDC2022 sample sequences (UART link and flash log)
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _SAMPLECODEC_HPP_
+#define _SAMPLECODEC_HPP_
+
+#include <stdint.h>
+
+/*
+ *  Block layout (every block decodes on its own, start a new one per flash page or UART frame) :
+ *
+ *      shift                           1 byte  : codes are stored as (code >> shift), 2 = 14 bit, 5 = 11 bit, 7 = 9 bit
+ *      timestamp, temperature, humidity        : first sample as three unsigned varints
+ *      records...
+ *
+ *  Record :
+ *      0b0TTTTHHH                      1 byte  : same period as before, zig-zag temperature delta in T, humidity delta in H
+ *      0x80, dod, dT, dH               long    : zig-zag varints, dod = (period - previous period)
+ *
+ *  Pure C++, no HAL dependency : the same file builds the host decoder (Firmware/Tools/SampleDecoder).
+ *
+ *  The live Log_c / UART path of acquire() does not go through this codec :
+ *      - a block decodes only once its length is known, a 2 KB block at 1.1 B/sample holds half an hour of
+ *        samples, the console would show nothing until the block is flushed
+ *      - Log_c drops whole records when its ring is full, a dropped byte inside a block corrupts every
+ *        sample after it, a dropped token record loses only itself
+ *      - behind Deadband_c a record is logged about once a minute, deltas of that spacing do not fit the
+ *        1 byte form (4.6 B/sample in SampleDecoder --bench against 26 B for the token record)
+ *  The codec is for batch transfers that are stored and sent as whole blocks (flash pages, UART dumps).
+ */
+
+#define CODEC_MAX_RECORD      16      /*  Worst case bytes for one encoded sample                 */
+
+typedef struct
+{
+  uint32_t timestamp;                 /*  Sample time (ms)                                        */
+  uint16_t temperature;               /*  Raw temperature code                                    */
+  uint16_t humidity;                  /*  Raw humidity code                                       */
+} codec_sample_t;
+
+
+class SampleEncoder_c {
+
+public:
+
+  void      Init(uint8_t shift);
+  void      Reset();
+
+  uint16_t  encode(const codec_sample_t *sample, uint8_t *out, uint16_t size);
+  uint32_t  get_Count();
+
+private:
+
+uint8_t  shift;
+uint8_t  started;
+uint32_t count;
+uint32_t prev_timestamp;
+uint32_t prev_period;
+uint16_t prev_temperature;
+uint16_t prev_humidity;
+
+};
+
+
+class SampleDecoder_c {
+
+public:
+
+  void      Reset();
+
+  uint8_t   decode(const uint8_t *in, uint16_t size, uint16_t *consumed, codec_sample_t *sample);
+
+private:
+
+uint8_t  shift;
+uint8_t  state;                       /*  0 = expect block header, 1 = expect records              */
+uint32_t prev_timestamp;
+uint32_t prev_period;
+uint16_t prev_temperature;
+uint16_t prev_humidity;
+
+};
+#endif
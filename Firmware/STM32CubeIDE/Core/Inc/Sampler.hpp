@@ -0,0 +1,84 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Hardware-timed sampling clock with 64 bit timestamps and jitter instrumentation
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _SAMPLER_HPP_
+#define _SAMPLER_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+#include <HDC2022Regs.hpp>
+#include <RtcClock.hpp>
+
+#define SAMPLER_TICK_HZ       32000U  /*  LPTIM1 kernel clock : LSI, no prescaler                  */
+#define SAMPLER_MIN_LEAD      4U      /*  Ticks, closer compare targets are not left to CMP        */
+
+/*
+ *  LPTIM1 counts free running from LSI (31.25 us tick). Its overflows extend the counter to a monotonic
+ *  64 bit timebase, and CMP marks the sampling instants on a fixed grid (period * n), so the sample rate
+ *  never depends on how fast the main loop spins. A sample carries the grid instant of its trigger.
+ *
+ *  The trigger is only flagged from the interrupt, the I2C MEAS_TRIG is written from thread context by
+ *  the caller. mark_Triggered() measures that software latency, and its change between two samples is
+ *  the period jitter the sensor actually sees.
+ *
+ *  LPTIM1 keeps running in STOP2 on STM32L476 (LPTIM2 does not), and LowPower_c takes its deadline from
+ *  the same compare through set_Wakeup(), so the sampler does not hold the core in STOP1. The TIM HAL is
+ *  left disabled, the general purpose timers stop in every STOP mode.
+ */
+
+class Sampler_c {
+
+public:
+
+  typedef struct
+  {
+    uint64_t timestamp;               /*  Trigger instant, SAMPLER_TICK_HZ ticks                     */
+    RtcClock_c::rtc_stamp_t wall;     /*  Unix time at the trigger, RtcClock_c, 0 without LSE         */
+    hdc_raw_sample_t raw;             /*  Sensor codes, HDC2022_c::decode_Temperature() / _Humidity() where units are needed  */
+  }sample_t;
+
+  typedef struct
+  {
+    uint32_t triggers;                /*  Sampling instants handed to the caller                     */
+    uint32_t overruns;                /*  Instants lost, the previous one was not taken in time      */
+    uint32_t last_latency;            /*  Grid instant to mark_Triggered(), ticks                    */
+    uint32_t worst_latency;           /*  Worst grid instant to mark_Triggered(), ticks              */
+    int32_t  last_jitter;             /*  Trigger period minus nominal period, ticks                 */
+    uint32_t worst_jitter;            /*  Worst absolute period deviation, ticks                     */
+    uint32_t jitter_events;           /*  Periods off by more than one tick                          */
+  }jitter_stats_t;
+
+  void      Init(uint32_t period_ms);
+  void      Stop();
+  void      set_Notify(void (*notify)(void));
+  void      set_Wakeup(uint32_t ms);
+  uint8_t   take_Wakeup();
+
+  uint64_t  get_Timestamp();
+  uint8_t   poll_Trigger(uint64_t *timestamp);
+  void      mark_Triggered();
+
+  static uint64_t to_Microseconds(uint64_t ticks);
+  const jitter_stats_t &get_Statistics();
+
+private:
+
+uint64_t taken_stamp = 0;
+uint8_t latency_valid = 0;
+jitter_stats_t stats = {};
+
+};
+
+extern "C" void Sampler_LPTIM_IRQHandler(void);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Cooperative run-to-completion scheduler : ISR-posted events, timers, priorities
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _SCHEDULER_HPP_
+#define _SCHEDULER_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+
+#define SCHED_MAX_EVENTS      16      /*  Event slots, at most 32                                  */
+#define SCHED_MAX_TIMERS      8       /*  Timer slots                                              */
+#define SCHED_PRIORITIES      4       /*  0 = highest                                              */
+#define SCHED_NO_ID           0xFF    /*  add_Event() / add_Timer() out of slots                   */
+#define SCHED_FOREVER         0xFFFFFFFF
+
+/*
+ *  Everything is allocated statically. An event is a handler with a priority, post() only sets its
+ *  pending bit and is safe from any interrupt, posting an already pending event merges with it.
+ *  run() dispatches the highest priority pending event, lowest id first, every handler runs to completion.
+ *  When nothing is pending the idle hook is called with interrupts masked and the time to the next timer,
+ *  WFI still wakes on the masked interrupt, so a post() right before sleeping is never lost.
+ *
+ *  Dispatch latency is post() to handler entry per event, counted in DWT cycles and stored in us at
+ *  dispatch : ClockGovernor_c changes SystemCoreClock, so cycles recorded at 2 MHz and at 80 MHz would not
+ *  compare. A latency across a transition is converted with the clock at dispatch.
+ */
+
+class Scheduler_c {
+
+public:
+
+  typedef void (*handler_t)(void);
+  typedef uint32_t (*clock_fn_t)(void);
+  typedef void (*idle_fn_t)(uint32_t sleep_ms);
+
+  typedef struct
+  {
+    uint32_t posts;                   /*  post() calls, merged ones included                         */
+    uint32_t dispatches;              /*  Handler runs                                               */
+    uint32_t last_latency;            /*  post() to handler entry, us                                */
+    uint32_t worst_latency;           /*  Worst post() to handler entry, us                          */
+  }event_stats_t;
+
+  void      Init(clock_fn_t now_ms, idle_fn_t idle);
+
+  uint8_t   add_Event(handler_t handler, uint8_t priority);
+  void      post(uint8_t event);
+
+  uint8_t   add_Timer(uint8_t event, uint32_t period_ms, uint8_t periodic);
+  void      start_Timer(uint8_t timer, uint32_t delay_ms);
+  void      stop_Timer(uint8_t timer);
+
+  uint8_t   run_Once();
+  void      run();
+
+  const event_stats_t &get_Statistics(uint8_t event);
+
+private:
+
+  typedef struct
+  {
+    handler_t handler;
+    uint8_t   priority;
+    uint32_t  stamp;                  /*  DWT->CYCCNT of the first unserved post()                   */
+  }sched_event_t;
+
+  typedef struct
+  {
+    uint32_t  due;
+    uint32_t  period;
+    uint8_t   event;
+    uint8_t   active;
+    uint8_t   periodic;
+  }sched_timer_t;
+
+  uint32_t  poll_Timers();
+
+clock_fn_t now_ms;
+idle_fn_t idle;
+uint8_t event_count = 0;
+uint8_t timer_count = 0;
+volatile uint32_t pending[SCHED_PRIORITIES] = {};
+sched_event_t events[SCHED_MAX_EVENTS];
+sched_timer_t timers[SCHED_MAX_TIMERS];
+event_stats_t stats[SCHED_MAX_EVENTS] = {};
+
+};
+#endif
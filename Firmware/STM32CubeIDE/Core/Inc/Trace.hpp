@@ -0,0 +1,75 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        ITM/SWO event trace points with hardware timestamps
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _TRACE_HPP_
+#define _TRACE_HPP_
+
+#include <stdint.h>
+#include <stm32l4xx_hal.h>
+
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE          1       /*  0 = every TRACE() compiles to nothing                    */
+#endif
+
+#define TRACE_SWO_BAUD        1000000 /*  SWO NRZ bit rate, a divisor of both 2 MHz and 80 MHz     */
+
+/*
+ *  One trace point is one 32 bit write to the ITM stimulus port numbered after the event, about 5 cycles
+ *  when the port is enabled and its FIFO has room. A full FIFO drops the event instead of waiting, the
+ *  decoder then sees an overflow packet. The ITM adds a local timestamp packet (core clock, no prescaler)
+ *  to the events, so the trace point itself does not read a clock.
+ *
+ *  The SWO pin is PB3 (JTDO-TRACESWO, AF0 after reset). ClockGovernor_c calls retime() on every SYSCLK
+ *  change, which keeps the SWO bit rate and emits TRACE_CLOCK so the decoder converts cycles with the
+ *  right frequency. Capture with any SWO probe at TRACE_SWO_BAUD, decode with Firmware/Tools/TraceDecoder.
+ */
+
+typedef enum
+{
+  TRACE_CLOCK = 1,                    /*  Core clock changed, Hz                                     */
+  TRACE_I2C_START,                    /*  HDC2022_c transaction : write << 16 | reg << 8 | len       */
+  TRACE_I2C_END,                      /*  HDC2022_c transaction : result_t                           */
+  TRACE_BUS_PUSH,                     /*  I2CBus_c submit() : depth << 16 | address << 8 | reg       */
+  TRACE_BUS_START,                    /*  I2CBus_c transfer start : len << 16 | address << 8 | reg   */
+  TRACE_BUS_DONE,                     /*  I2CBus_c transfer end : 1 = OK                             */
+  TRACE_DRDY,                         /*  DRDY/INT pin edge                                          */
+  TRACE_SAMPLE,                       /*  Sample decoded : humidity code << 16 | temperature code    */
+  TRACE_SCHED_POST,                   /*  Scheduler_c post() : event id                              */
+  TRACE_SCHED_RUN,                    /*  Scheduler_c dispatch : event id                            */
+  TRACE_USER = 16,                    /*  16 .. 31 free for application trace points                 */
+}trace_event_t;
+
+class Trace_c {
+
+public:
+
+  void      Init();
+  static void retime();
+
+  static inline void event(trace_event_t id, uint32_t value)
+  {
+      if ((ITM->TER & (1UL << id)) && (ITM->PORT[id].u32 != 0))
+      {
+          ITM->PORT[id].u32 = value;
+      }
+  }
+
+};
+
+#if TRACE_ENABLE
+#define TRACE(id, value)      Trace_c::event((id), (uint32_t)(value))
+#else
+#define TRACE(id, value)      ((void)0)
+#endif
+
+#endif
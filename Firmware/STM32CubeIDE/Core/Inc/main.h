@@ -32,6 +32,7 @@ extern "C" {
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "Placement.h"
 
 /* USER CODE END Includes */
 
@@ -54,6 +55,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void SystemClock_Config(void);
 
 /* USER CODE END EFP */
 
@@ -66,6 +68,9 @@ void Error_Handler(void);
 #define USART_RX_GPIO_Port GPIOA
 #define LD2_Pin GPIO_PIN_5
 #define LD2_GPIO_Port GPIOA
+#define HDC_INT_Pin GPIO_PIN_8
+#define HDC_INT_GPIO_Port GPIOA
+#define HDC_INT_EXTI_IRQn EXTI9_5_IRQn
 #define TMS_Pin GPIO_PIN_13
 #define TMS_GPIO_Port GPIOA
 #define TCK_Pin GPIO_PIN_14
@@ -73,6 +78,30 @@ void Error_Handler(void);
 #define SWO_Pin GPIO_PIN_3
 #define SWO_GPIO_Port GPIOB
 /* USER CODE BEGIN Private defines */
+#ifndef RAM2_BENCH
+#define RAM2_BENCH 0          /* 1 = time a kernel from flash and from SRAM2 at boot, logged once */
+#endif
+#ifndef SYSMEM_HEAP_TRAP
+#define SYSMEM_HEAP_TRAP 0    /* 1 = _sbrk() traps on its first call, heap-free build (Pool.hpp) */
+#endif
+#ifndef DEADBAND_TEMPERATURE
+#define DEADBAND_TEMPERATURE 0.1f       /* °C change that is logged, smaller ones are counted as skipped */
+#endif
+#ifndef DEADBAND_HUMIDITY
+#define DEADBAND_HUMIDITY 0.5f          /* %RH change that is logged */
+#endif
+#ifndef DEADBAND_HEARTBEAT_MS
+#define DEADBAND_HEARTBEAT_MS 60000     /* a sample is logged at least this often, 0 = only changes */
+#endif
+#ifndef RTC_BUILD_UTC_OFFSET
+#define RTC_BUILD_UTC_OFFSET 0          /* s east of UTC on the build machine, __DATE__ / __TIME__ seed the RTC */
+#endif
+#ifndef PEAK_MONITOR
+#define PEAK_MONITOR 0        /* N > 0 = peak mode : data and maxima read in one burst every N conversions */
+#endif
+#ifndef PEAK_RESET_READS
+#define PEAK_RESET_READS 60   /* Peak mode : maxima cleared (soft reset) after this many reads */
+#endif
 
 /* USER CODE END Private defines */
 
@@ -0,0 +1,402 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Clock governor : low-power run on MSI for idle sampling, PLL 80 MHz for compute bursts
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <ClockGovernor.hpp>
+#include <I2CBus.hpp>
+#include <Trace.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <ClockGovernor.hpp>
+ *	ClockGovernor_c Governor;
+ * 	void main()
+ * 	{
+ * 	 HDC2022.Init(hi2c1,10);
+ * 	 Governor.attach_I2C(&hi2c1);
+ * 	 Governor.attach_Bus(&I2CBus);			// optional, held across every switch
+ * 	 Governor.Init();
+ * 	 Governor.set_Mode(ClockGovernor_c::CLOCK_LOW);
+ * 		while(1)
+ * 		{
+ *			sample = HDC2022.get_Temperature();
+ *			if(page_full)
+ *			{
+ *				Governor.request_Full();
+ *				encode_Page();
+ *				Governor.release_Full();
+ *			}
+ * 		}
+ * 	}
+ *
+ * The example app only uses set_Mode() : its loop is I2C and UART bound, at 80 MHz it would only spin
+ * faster in the wait loops. request_Full() / release_Full() are for work that is compute bound.
+ */
+
+#define I2C_TLOW_NS         5000U       /*  >= 4.7 us standard mode, with the sync delays ~100 kHz   */
+#define I2C_THIGH_NS        4000U       /*  >= 4.0 us standard mode                                   */
+#define I2C_TSUDAT_NS       250U        /*  Data setup time                                           */
+#define I2C_TF_NS           300U        /*  Fall time                                                 */
+#define I2C_TAF_MIN_NS      50U         /*  Analog filter minimum delay                               */
+
+/**
+ * @brief  Nanoseconds to Timer Ticks
+ * @note   Rounded up, 64 bit intermediate so 80 MHz * 5000 ns does not overflow
+ * @param  uint32_t ns		:	Duration
+ * @param  uint32_t clock		:	Kernel clock (Hz)
+ * @param  uint32_t div		:	Prescaler division
+ * @retval uint32_t
+ */
+static uint32_t ns_to_Ticks(uint32_t ns, uint32_t clock, uint32_t div)
+{
+    uint64_t den = (uint64_t)div * 1000000000U;
+
+    return (uint32_t)(((uint64_t)ns * clock + den - 1) / den);
+}
+
+/**
+ * @brief  Compute I2C TIMINGR
+ * @note   100 kHz standard mode, analog filter on, digital filter off. PRESC is chosen for a ~250 ns
+ * 		tick so the same formula holds from MSI 2 MHz up to 80 MHz
+ * @param  uint32_t i2c_clock	:	I2C kernel clock (Hz), PCLK1 here
+ * @retval uint32_t			:	TIMINGR value for I2C_InitTypeDef::Timing
+ */
+uint32_t ClockGovernor_c::calc_I2CTiming(uint32_t i2c_clock)
+{
+
+    uint32_t presc, scll, sclh, scldel, sdadel = 0;
+    uint32_t t_clk_ns = 1000000000U / i2c_clock;
+
+    presc = (i2c_clock + 3999999U) / 4000000U;
+    presc = (presc == 0) ? 0 : presc - 1;
+    if (presc > 15)
+    {
+        presc = 15;
+    }
+
+    scll = ns_to_Ticks(I2C_TLOW_NS, i2c_clock, presc + 1) - 1;
+    sclh = ns_to_Ticks(I2C_THIGH_NS, i2c_clock, presc + 1) - 1;
+    scldel = ns_to_Ticks(I2C_TSUDAT_NS, i2c_clock, presc + 1) - 1;
+    if ((I2C_TF_NS - I2C_TAF_MIN_NS) > 3 * t_clk_ns)
+    {
+        sdadel = ns_to_Ticks(I2C_TF_NS - I2C_TAF_MIN_NS - 3 * t_clk_ns, i2c_clock, presc + 1);
+    }
+
+    scll = (scll > 255) ? 255 : scll;
+    sclh = (sclh > 255) ? 255 : sclh;
+    scldel = (scldel > 15) ? 15 : scldel;
+    sdadel = (sdadel > 15) ? 15 : sdadel;
+
+    return (presc << I2C_TIMINGR_PRESC_Pos) | (scldel << I2C_TIMINGR_SCLDEL_Pos) | (sdadel << I2C_TIMINGR_SDADEL_Pos)
+        | (sclh << I2C_TIMINGR_SCLH_Pos) | (scll << I2C_TIMINGR_SCLL_Pos);
+
+}
+
+/**
+ * @brief  Clock Governor Initialization Function
+ * @note   Use after SystemClock_Config() and the attach calls, picks up the running mode
+ * @param  None
+ * @retval None
+ */
+void ClockGovernor_c::Init()
+{
+
+    uint8_t held = drain();
+
+    mode = (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_PLLCLK) ? CLOCK_FULL : CLOCK_LOW;
+    base = mode;
+    full_requests = 0;
+    transitions = 0;
+    retime();
+    if (held)
+    {
+        bus->release();
+    }
+
+}
+
+/**
+ * @brief  Attach I2C Handle
+ * @note   TIMINGR of the handle is recomputed from PCLK1 on every transition
+ * @param  I2C_HandleTypeDef *hi2c
+ * @retval None
+ */
+void ClockGovernor_c::attach_I2C(I2C_HandleTypeDef *hi2c)
+{
+
+    if (i2c_count < GOVERNOR_MAX_I2C)
+    {
+        i2c[i2c_count++] = hi2c;
+    }
+
+}
+
+/**
+ * @brief  Attach UART Handle
+ * @note   BRR of the handle is recomputed from PCLK1 on every transition
+ * @param  UART_HandleTypeDef *huart
+ * @retval None
+ */
+void ClockGovernor_c::attach_UART(UART_HandleTypeDef *huart)
+{
+
+    if (uart_count < GOVERNOR_MAX_UART)
+    {
+        uart[uart_count++] = huart;
+    }
+
+}
+
+/**
+ * @brief  Attach Shared I2C Bus
+ * @note   The bus is held from before every clock switch until its handle is retimed, queued transfers
+ * 		start after with the new TIMINGR. Attach its handle with attach_I2C() as well
+ * @param  I2CBus_c *bus
+ * @retval None
+ */
+void ClockGovernor_c::attach_Bus(I2CBus_c *bus)
+{
+
+    this->bus = bus;
+
+}
+
+/**
+ * @brief  Set Idle Mode
+ * @note   Applied at once unless a burst holds the full speed, then on the last release_Full()
+ * @param  mode_t mode	:	CLOCK_LOW or CLOCK_FULL
+ * @retval None
+ */
+void ClockGovernor_c::set_Mode(mode_t mode)
+{
+
+    base = mode;
+    if (full_requests == 0)
+    {
+        switch_Mode(mode);
+    }
+
+}
+
+/**
+ * @brief  Get Running Mode
+ * @note   None
+ * @param  None
+ * @retval mode_t
+ */
+ClockGovernor_c::mode_t ClockGovernor_c::get_Mode()
+{
+
+    return mode;
+
+}
+
+/**
+ * @brief  Enter Compute Burst
+ * @note   Nested calls are counted, the core stays at 80 MHz until the matching release_Full()
+ * @param  None
+ * @retval None
+ */
+void ClockGovernor_c::request_Full()
+{
+
+    if (full_requests++ == 0)
+    {
+        switch_Mode(CLOCK_FULL);
+    }
+
+}
+
+/**
+ * @brief  Leave Compute Burst
+ * @note   Returns to the mode given to set_Mode() on the last release
+ * @param  None
+ * @retval None
+ */
+void ClockGovernor_c::release_Full()
+{
+
+    if ((full_requests != 0) && (--full_requests == 0))
+    {
+        switch_Mode(base);
+    }
+
+}
+
+/**
+ * @brief  Get Transition Count
+ * @note   None
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t ClockGovernor_c::get_Transitions()
+{
+
+    return transitions;
+
+}
+
+/**
+ * @brief  Switch System Clock
+ * @note   LOW  : MSI 2 MHz -> SYSCLK, PLL off, Range 2, LPR set, STOP wake-up on MSI. HSI16 stays on
+ * 		as USART2 kernel clock
+ * 		FULL : LPR cleared, Range 1 before the PLL is started, SystemClock_Config(), STOP wake-up on HSI16
+ * 		HAL_RCC_ClockConfig() updates SystemCoreClock and the SysTick reload
+ * @param  mode_t mode
+ * @retval None
+ */
+void ClockGovernor_c::switch_Mode(mode_t mode)
+{
+
+    uint8_t held;
+
+    if (mode == this->mode)
+    {
+        return;
+    }
+
+    held = drain();
+
+    if (mode == CLOCK_LOW)
+    {
+        RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+        RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+        RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_MSI;
+        RCC_OscInitStruct.MSIState = RCC_MSI_ON;
+        RCC_OscInitStruct.MSICalibrationValue = RCC_MSICALIBRATION_DEFAULT;
+        RCC_OscInitStruct.MSIClockRange = RCC_MSIRANGE_5;
+        RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+        if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+        RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_MSI;
+        RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+        RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+        RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+        if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_RCC_PLL_DISABLE();
+
+        if (HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE2) != HAL_OK)
+        {
+            Error_Handler();
+        }
+        HAL_PWREx_EnableLowPowerRunMode();
+        __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_MSI);
+    }
+    else
+    {
+        if (HAL_PWREx_DisableLowPowerRunMode() != HAL_OK)
+        {
+            Error_Handler();
+        }
+        if (HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE1) != HAL_OK)
+        {
+            Error_Handler();
+        }
+        SystemClock_Config();
+        __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_HSI);
+    }
+
+    this->mode = mode;
+    transitions++;
+    retime();
+    if (held)
+    {
+        bus->release();
+    }
+
+}
+
+/**
+ * @brief  Drain Attached Peripherals
+ * @note   Before the clock switch : holds the attached I2CBus_c (waits for the transfer in flight, new ones
+ * 		stay queued), then waits for every I2C handle to be ready and every UART to finish its last frame
+ * 		(TC). Each wait ends after GOVERNOR_DRAIN_MS, counted on DWT so a caller with interrupts masked
+ * 		does not hang : that transfer can not complete and HAL_I2C_Init() in retime() cuts it. The bus
+ * 		is not held then, hold() times out on HAL_GetTick()
+ * @param  None
+ * @retval uint8_t	:	1 = bus held, release() after retime()
+ */
+uint8_t ClockGovernor_c::drain()
+{
+
+    uint32_t start = DWT->CYCCNT;
+    uint32_t limit = GOVERNOR_DRAIN_MS * (SystemCoreClock / 1000U);
+    uint8_t held = 0;
+
+    if ((bus != NULL) && (__get_PRIMASK() == 0))
+    {
+        bus->hold(GOVERNOR_DRAIN_MS);
+        held = 1;
+    }
+
+    for (uint8_t i = 0; i < i2c_count; i++)
+    {
+        while ((i2c[i]->State != HAL_I2C_STATE_READY) && ((DWT->CYCCNT - start) < limit))
+        {
+        }
+    }
+
+    for (uint8_t i = 0; i < uart_count; i++)
+    {
+        while (((uart[i]->gState != HAL_UART_STATE_READY) || (__HAL_UART_GET_FLAG(uart[i], UART_FLAG_TC) == 0))
+               && ((DWT->CYCCNT - start) < limit))
+        {
+        }
+    }
+
+    return held;
+
+}
+
+/**
+ * @brief  Retime Attached Peripherals
+ * @note   After drain() and the switch : HAL_I2C_Init() / HAL_UART_Init() rewrite TIMINGR / BRR with the
+ * 		peripheral disabled. MspInit is not called again, the handles are not in RESET state
+ * @param  None
+ * @retval None
+ */
+void ClockGovernor_c::retime()
+{
+
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+
+    for (uint8_t i = 0; i < i2c_count; i++)
+    {
+        i2c[i]->Init.Timing = calc_I2CTiming(pclk1);
+        if (HAL_I2C_Init(i2c[i]) != HAL_OK)
+        {
+            Error_Handler();
+        }
+    }
+
+    for (uint8_t i = 0; i < uart_count; i++)
+    {
+        if (HAL_UART_Init(uart[i]) != HAL_OK)
+        {
+            Error_Handler();
+        }
+    }
+
+    Trace_c::retime();
+
+}
@@ -0,0 +1,195 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Report-on-change (deadband + heartbeat) filter for HDC2022 samples
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <Deadband.hpp>
+
+#define TEMPERATURE_CODES_PER_C     (65536.0f / 165.0f)
+#define HUMIDITY_CODES_PER_RH       (65536.0f / 100.0f)
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <Deadband.hpp>
+ *	HDC2022_c HDC2022;
+ *	Deadband_c Deadband;
+ * 	void main()
+ * 	{
+ * 	 HDC2022.Init(hi2c1,100);
+ * 	 Deadband.Init(0.1f, 0.5f, 60000);
+ * 		while(1)
+ * 		{
+ *			HDC2022.get_Sample(raw);
+ *			if(Deadband.update(raw, HAL_GetTick()))
+ *			{
+ *				send(raw, Deadband.get_Suppressed());
+ *			}
+ * 		}
+ * 	}
+ */
+
+/**
+ * @brief  Unit To Code
+ * @note   Rounded and clamped to the 16 bit code range
+ * @param  float value
+ * @retval uint16_t
+ */
+static uint16_t to_Code(float value)
+{
+
+    if (value <= 0.0f)
+    {
+        return 0;
+    }
+    if (value >= 65535.0f)
+    {
+        return 65535;
+    }
+    return (uint16_t)(value + 0.5f);
+
+}
+
+/**
+ * @brief  Deadband Initialization Function
+ * @note   A sample is reported when one channel moves by more than its delta from the last reported
+ * 		value, or when heartbeat milliseconds elapsed since the last report. The deltas are turned
+ * 		into sensor codes here once, update() then compares codes only
+ * @param  float temperature_delta	:	Temperature deadband (°C)
+ * @param  float humidity_delta		:	Humidity deadband (%RH)
+ * @param  uint32_t heartbeat		:	Maximum report interval (ms), 0 disables the heartbeat
+ * @retval None
+ */
+void Deadband_c::Init(float temperature_delta, float humidity_delta, uint32_t heartbeat)
+{
+
+    this->temperature_delta = to_Code(temperature_delta * TEMPERATURE_CODES_PER_C);
+    this->humidity_delta = to_Code(humidity_delta * HUMIDITY_CODES_PER_RH);
+    this->heartbeat = heartbeat;
+    Reset();
+
+}
+
+/**
+ * @brief  Deadband Reset Function
+ * @note   Forgets the last reported value and clears all counters, the next sample is always reported
+ * @param  None
+ * @retval None
+ */
+void Deadband_c::Reset()
+{
+
+    last_temperature = 0;
+    last_humidity = 0;
+    last_timestamp = 0;
+    primed = 0;
+    suppressed_run = 0;
+    suppressed_last = 0;
+    suppressed_total = 0;
+    emitted = 0;
+
+}
+
+/**
+ * @brief  Feed One Sample
+ * @note   Integer only. timestamp wraps like HAL_GetTick(), unsigned subtraction keeps the heartbeat correct
+ * @param  const hdc_raw_sample_t &sample	:	Sensor codes
+ * @param  uint32_t timestamp			:	Sample time (ms)
+ * @retval uint8_t					:	1 = report this sample, 0 = suppressed
+ */
+uint8_t Deadband_c::update(const hdc_raw_sample_t &sample, uint32_t timestamp)
+{
+
+    uint16_t dt = (sample.temperature > last_temperature) ? (uint16_t)(sample.temperature - last_temperature)
+                                                          : (uint16_t)(last_temperature - sample.temperature);
+    uint16_t dh = (sample.humidity > last_humidity) ? (uint16_t)(sample.humidity - last_humidity)
+                                                    : (uint16_t)(last_humidity - sample.humidity);
+
+    if (primed && (dt <= temperature_delta) && (dh <= humidity_delta)
+        && ((heartbeat == 0) || ((uint32_t)(timestamp - last_timestamp) < heartbeat)))
+    {
+        suppressed_run++;
+        suppressed_total++;
+        return 0;
+    }
+
+    last_temperature = sample.temperature;
+    last_humidity = sample.humidity;
+    last_timestamp = timestamp;
+    primed = 1;
+
+    suppressed_last = suppressed_run;
+    suppressed_run = 0;
+    emitted++;
+    return 1;
+
+}
+
+/**
+ * @brief  Feed One Sample In Units
+ * @note   For values that were already converted, turned back into codes and fed to update(sample)
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @param  uint32_t timestamp	:	Sample time (ms)
+ * @retval uint8_t			:	1 = report this sample, 0 = suppressed
+ */
+uint8_t Deadband_c::update(float temperature, float humidity, uint32_t timestamp)
+{
+
+    hdc_raw_sample_t sample;
+
+    sample.temperature = to_Code((temperature + 40.0f) * TEMPERATURE_CODES_PER_C);
+    sample.humidity = to_Code(humidity * HUMIDITY_CODES_PER_RH);
+
+    return update(sample, timestamp);
+
+}
+
+/**
+ * @brief  Get Suppressed Sample Count
+ * @note   Number of samples dropped right before the last reported one, ship it with the report
+ * 		so the consumer can rebuild the exact sample count
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t Deadband_c::get_Suppressed()
+{
+
+    return suppressed_last;
+
+}
+
+/**
+ * @brief  Get Total Suppressed Sample Count
+ * @note   None
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t Deadband_c::get_SuppressedTotal()
+{
+
+    return suppressed_total;
+
+}
+
+/**
+ * @brief  Get Reported Sample Count
+ * @note   None
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t Deadband_c::get_Emitted()
+{
+
+    return emitted;
+
+}
@@ -0,0 +1,348 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Interrupt driven async HDC2022 operations over a pluggable I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <HDC2022Async.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <HDC2022Async.hpp>
+ *	HDC2022Async_c SensorAsync;
+ *	static async_t pt, op;
+ *	static HDC2022Async_c::raw_sample_t raw;
+ *	static uint8_t status;
+ *	uint8_t acquire(void)
+ *	{
+ *	 ASYNC_BEGIN(&pt);
+ *	 ASYNC_CALL(&pt, &op, SensorAsync.read_Status(&op, &status));
+ *	 if(HDC2022Map::STATUS::DRDY_STATUS::get(status))
+ *	 {
+ *	  ASYNC_CALL(&pt, &op, SensorAsync.read_Sample(&op, &raw));
+ *	 }
+ *	 ASYNC_END(&pt);
+ *	}
+ * 	void main()
+ * 	{
+ * 	 SensorAsync.bind_Bus(&I2CBus, 0x40 << 1, 0);
+ * 	 SensorAsync.set_Notify(resume);		// e.g. posts the Scheduler_c event that calls acquire()
+ * 	}
+ */
+
+#define REG_TEMPERATURE_LOW         HDC2022Map::TEMPERATURE_LOW::address
+#define REG_STATUS                  HDC2022Map::STATUS::address
+#define REG_MEASUREMENT_CONFIG      HDC2022Map::MEASUREMENT_CONFIGURATION::address
+#define REG_DEVICE_CONFIG           HDC2022Map::DEVICE_CONFIGURATION::address
+#define REG_CONFIG_FIRST            HDC2022Map::INTERRUPT_ENABLE::address
+#define CONFIG_BYTES                (REG_MEASUREMENT_CONFIG - REG_CONFIG_FIRST + 1)
+#define PEAK_BYTES                  (HDC2022Map::HUMIDITY_MAX::address - REG_TEMPERATURE_LOW + 1)
+
+/**
+ * @brief  Async Driver Initialization Function
+ * @note   None
+ * @param  const async_bus_t *bus	:	Bus binding, must outlive the object
+ * @retval None
+ */
+void HDC2022Async_c::Init(const async_bus_t *bus)
+{
+
+    this->bus = bus;
+    done = 0;
+    ASYNC_RESET(&xfer);
+
+}
+
+/**
+ * @brief  Set Completion Notification
+ * @note   Called from complete(), i.e. interrupt context on the target, to resume the waiting async function
+ * @param  void (*notify)(void)	:	NULL = poll only
+ * @retval None
+ */
+void HDC2022Async_c::set_Notify(void (*notify)(void))
+{
+
+    this->notify = notify;
+
+}
+
+/**
+ * @brief  Transfer Complete
+ * @note   Called by the bus when the started transfer ends
+ * @param  uint8_t ok	:	1 = success, 0 = bus error or NACK
+ * @retval None
+ */
+void HDC2022Async_c::complete(uint8_t ok)
+{
+
+    this->ok = ok;
+    done = 1;
+    if (notify)
+    {
+        notify();
+    }
+
+}
+
+/**
+ * @brief  Abort Operation
+ * @note   Drops the transfer in flight after a timeout, the next operation starts over. The bus binding is kept.
+ * 		The bus cancels the transfer first : a late completion of the old transfer would otherwise be
+ * 		taken for the next operation's, and its descriptor would be submitted twice
+ * @param  None
+ * @retval None
+ */
+void HDC2022Async_c::abort()
+{
+
+    if ((bus != 0) && (bus->cancel != 0))
+    {
+        bus->cancel(bus->ctx);
+    }
+    done = 0;
+    ASYNC_RESET(&xfer);
+
+}
+
+/**
+ * @brief  Async Register Transfer
+ * @note   Resumes on xfer, len bytes from/to buffer or data
+ * @param  uint8_t reg		:	First register, the device auto-increments
+ * @param  uint16_t len		:	Number of bytes, at most sizeof(buffer) without data
+ * @param  uint8_t write		:	1 = write, 0 = read
+ * @param  uint8_t *data		:	Caller owned bytes valid until the end, 0 = buffer
+ * @retval uint8_t			:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::transfer(uint8_t reg, uint16_t len, uint8_t write, uint8_t *data)
+{
+
+    ASYNC_BEGIN(&xfer);
+
+    if (data == 0)
+    {
+        data = buffer;
+    }
+    done = 0;
+    if (!(write ? bus->write(bus->ctx, reg, data, len) : bus->read(bus->ctx, reg, data, len)))
+    {
+        stats.errors++;
+        ASYNC_EXIT(&xfer, ASYNC_ERROR);
+    }
+
+    ASYNC_AWAIT(&xfer, done);
+
+    if (!ok)
+    {
+        stats.errors++;
+        ASYNC_EXIT(&xfer, ASYNC_ERROR);
+    }
+    stats.operations++;
+
+    ASYNC_END(&xfer);
+
+}
+
+/**
+ * @brief  Read Sample
+ * @note   One 4 byte burst from TEMPERATURE_LOW, temperature and humidity of the same conversion
+ * @param  async_t *pt			:	Caller owned frame
+ * @param  raw_sample_t *sample	:	Raw codes, valid on ASYNC_DONE
+ * @retval uint8_t				:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::read_Sample(async_t *pt, raw_sample_t *sample)
+{
+
+    ASYNC_BEGIN(pt);
+
+    ASYNC_CALL(pt, &xfer, transfer(REG_TEMPERATURE_LOW, 4, 0));
+    sample->temperature = (uint16_t)(buffer[0] | (buffer[1] << 8));
+    sample->humidity = (uint16_t)(buffer[2] | (buffer[3] << 8));
+
+    ASYNC_END(pt);
+
+}
+
+/**
+ * @brief  Read Status
+ * @note   Clears DRDY and the latched threshold bits on the device
+ * @param  async_t *pt		:	Caller owned frame
+ * @param  uint8_t *status	:	STATUS register, valid on ASYNC_DONE
+ * @retval uint8_t		:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::read_Status(async_t *pt, uint8_t *status)
+{
+
+    ASYNC_BEGIN(pt);
+
+    ASYNC_CALL(pt, &xfer, transfer(REG_STATUS, 1, 0));
+    *status = buffer[0];
+
+    ASYNC_END(pt);
+
+}
+
+/**
+ * @brief  Read Sample And Peaks
+ * @note   One 7 byte burst TEMPERATURE_LOW .. HUMIDITY_MAX, replaces read_Status() + read_Sample(). Clears
+ * 		DRDY and the latched threshold bits on the device, reset the maxima with restart()
+ * @param  async_t *pt			:	Caller owned frame
+ * @param  peak_sample_t *peaks	:	Valid on ASYNC_DONE
+ * @retval uint8_t				:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::read_Peaks(async_t *pt, peak_sample_t *peaks)
+{
+
+    ASYNC_BEGIN(pt);
+
+    ASYNC_CALL(pt, &xfer, transfer(REG_TEMPERATURE_LOW, PEAK_BYTES, 0));
+    peaks->last.temperature = (uint16_t)(buffer[0] | (buffer[1] << 8));
+    peaks->last.humidity = (uint16_t)(buffer[2] | (buffer[3] << 8));
+    peaks->status = buffer[4];
+    peaks->temperature_max = buffer[5];
+    peaks->humidity_max = buffer[6];
+
+    ASYNC_END(pt);
+
+}
+
+/**
+ * @brief  Trigger Measurement
+ * @note   Writes MEASUREMENT_CONFIGURATION with MEAS_TRIG set
+ * @param  async_t *pt			:	Caller owned frame
+ * @param  uint8_t configuration	:	MEASUREMENT_CONFIGURATION value, MEAS_TRIG is added
+ * @retval uint8_t				:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::trigger_Measurement(async_t *pt, uint8_t configuration)
+{
+
+    ASYNC_BEGIN(pt);
+
+    buffer[0] = HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(configuration, 1);
+    ASYNC_CALL(pt, &xfer, transfer(REG_MEASUREMENT_CONFIG, 1, 1));
+
+    ASYNC_END(pt);
+
+}
+
+/**
+ * @brief  Soft Reset And Restore
+ * @note   Sets SOFT_RES, polls DEVICE_CONFIGURATION until the device answers with SOFT_RES cleared
+ * 		(NACKs while it resets count as not yet), then writes the 9 configuration registers
+ * 		INTERRUPT_ENABLE .. MEASUREMENT_CONFIGURATION in one burst. ASYNC_ERROR after
+ * 		HDC2022_RESTART_POLLS polls or when the restore fails. Failed polls are counted in errors
+ * @param  async_t *pt					:	Caller owned frame
+ * @param  const uint8_t *configuration	:	9 register values from 0x07, e.g. HDC2022_c::get_Configuration()
+ * @retval uint8_t						:	ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Async_c::restart(async_t *pt, const uint8_t *configuration)
+{
+
+    ASYNC_BEGIN(pt);
+
+    buffer[0] = HDC2022Map::DEVICE_CONFIGURATION::SOFT_RES::mask;
+    ASYNC_CALL(pt, &xfer, transfer(REG_DEVICE_CONFIG, 1, 1));
+
+    for (polls = 0; ; )
+    {
+        ASYNC_RESET(&xfer);
+        ASYNC_AWAIT(pt, (poll_result = transfer(REG_DEVICE_CONFIG, 1, 0)) != ASYNC_RUNNING);
+        if ((poll_result == ASYNC_DONE) && !HDC2022Map::DEVICE_CONFIGURATION::SOFT_RES::get(buffer[0]))
+        {
+            break;
+        }
+        if (++polls >= HDC2022_RESTART_POLLS)
+        {
+            ASYNC_EXIT(pt, ASYNC_ERROR);
+        }
+    }
+
+    ASYNC_CALL(pt, &xfer, transfer(REG_CONFIG_FIRST, CONFIG_BYTES, 1, const_cast<uint8_t *>(configuration)));
+
+    ASYNC_END(pt);
+
+}
+
+/**
+ * @brief  Get Async Statistics
+ * @note   None
+ * @param  None
+ * @retval const async_stats_t &
+ */
+const HDC2022Async_c::async_stats_t &HDC2022Async_c::get_Statistics()
+{
+
+    return stats;
+
+}
+
+#ifdef USE_HAL_DRIVER
+
+uint8_t HDC2022Async_c::bus_Read(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return bus_Submit(ctx, reg, buf, len, 0);
+}
+
+uint8_t HDC2022Async_c::bus_Write(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return bus_Submit(ctx, reg, buf, len, 1);
+}
+
+uint8_t HDC2022Async_c::bus_Submit(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len, uint8_t write)
+{
+    HDC2022Async_c *self = (HDC2022Async_c *)ctx;
+
+    self->bus_txn.reg = reg;
+    self->bus_txn.write = write;
+    self->bus_txn.buf = buf;
+    self->bus_txn.len = len;
+    return self->shared_bus->submit(&self->bus_txn);
+}
+
+void HDC2022Async_c::bus_Done(i2c_txn_t *txn)
+{
+    ((HDC2022Async_c *)txn->ctx)->complete(txn->status == I2C_BUS_OK);
+}
+
+void HDC2022Async_c::bus_Cancel(void *ctx)
+{
+    HDC2022Async_c *self = (HDC2022Async_c *)ctx;
+
+    self->shared_bus->cancel(&self->bus_txn);
+}
+
+/**
+ * @brief  Bind to the Shared I2C Bus
+ * @note   Every transfer is queued as an I2CBus_c transaction, completion comes from the I2C interrupt.
+ * 		The transaction lives in the object, several sensors may share one bus
+ * @param  I2CBus_c *i2c_bus		:	Initialized bus
+ * @param  uint8_t address		:	8 bit device address, e.g. 0x40 << 1
+ * @param  uint8_t priority		:	Transaction priority on the bus, 0 = highest
+ * @retval None
+ */
+void HDC2022Async_c::bind_Bus(I2CBus_c *i2c_bus, uint8_t address, uint8_t priority)
+{
+
+    shared_bus = i2c_bus;
+    bus_txn.address = address;
+    bus_txn.priority = priority;
+    bus_txn.deadline = 0;
+    bus_txn.done = bus_Done;
+    bus_txn.ctx = this;
+    bus_binding.read = bus_Read;
+    bus_binding.write = bus_Write;
+    bus_binding.ctx = this;
+    bus_binding.cancel = bus_Cancel;
+    Init(&bus_binding);
+
+}
+
+#endif
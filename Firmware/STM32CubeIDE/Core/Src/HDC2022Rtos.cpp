@@ -0,0 +1,287 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Optional FreeRTOS adapter : shared HDC2022 bus with task notifications
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <HDC2022Rtos.hpp>
+
+#ifdef HDC2022_USE_FREERTOS
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <HDC2022Rtos.hpp>
+ *	HDC2022Async_c SensorAsync;
+ *	HDC2022Rtos_c SensorRtos;
+ *	void logger_Task(void *arg)
+ *	{
+ *	 HDC2022Async_c::raw_sample_t raw;
+ *		while(1)
+ *		{
+ *			SensorRtos.trigger_Measurement(0x00);
+ *			vTaskDelay(pdMS_TO_TICKS(5));
+ *			if(SensorRtos.read_Sample(&raw) == ASYNC_DONE) { ... }
+ *		}
+ *	}
+ * 	void main()
+ * 	{
+ * 	 SensorAsync.bind_Bus(&I2CBus, 0x40 << 1, 0);
+ * 	 SensorRtos.Init(&SensorAsync, tskIDLE_PRIORITY + 3, pdMS_TO_TICKS(10));
+ * 	 vTaskStartScheduler();
+ * 	}
+ */
+
+typedef enum
+{
+  REQUEST_SAMPLE = 0x00,
+  REQUEST_STATUS,
+  REQUEST_TRIGGER,
+} request_op_t;
+
+typedef struct
+{
+  request_op_t op;
+  uint8_t value;                        /*  Status read or configuration written                  */
+  uint8_t result;                       /*  ASYNC_DONE or ASYNC_ERROR                             */
+  HDC2022Async_c::raw_sample_t *sample;
+  TaskHandle_t requester;
+  volatile uint8_t done;                /*  Set by the bus task, last write to the request         */
+} request_t;
+
+static HDC2022Async_c *bus_sensor = NULL;
+static TaskHandle_t bus_task = NULL;
+static QueueHandle_t bus_queue = NULL;
+static TickType_t bus_timeout = 0;
+static volatile uint32_t bus_timeouts = 0;
+
+static StaticTask_t task_buffer;
+static StackType_t task_stack[HDC2022_RTOS_STACK];
+static StaticQueue_t queue_buffer;
+static uint8_t queue_storage[HDC2022_RTOS_QUEUE * sizeof(request_t *)];
+
+/**
+ * @brief  Wake Bus Task
+ * @note   HDC2022Async_c completion hook, interrupt context on the target
+ * @param  None
+ * @retval None
+ */
+static void notify_BusTask(void)
+{
+#ifdef USE_HAL_DRIVER
+    if (__get_IPSR() != 0)
+    {
+        BaseType_t woken = pdFALSE;
+
+        vTaskNotifyGiveFromISR(bus_task, &woken);
+        portYIELD_FROM_ISR(woken);
+        return;
+    }
+#endif
+    xTaskNotifyGive(bus_task);
+}
+
+/**
+ * @brief  Run One Request
+ * @note   Steps the async operation, sleeps on the completion notification between steps. A timeout
+ * 		aborts the operation, which cancels its bus transaction
+ * @param  request_t *request
+ * @retval uint8_t	:	ASYNC_DONE or ASYNC_ERROR
+ */
+static uint8_t run_Request(request_t *request)
+{
+    async_t pt = {0};
+    uint8_t result;
+
+    /*  A completion given after the last wait (cancelled or late transfer) must not count for this request  */
+    ulTaskNotifyTake(pdTRUE, 0);
+
+    while (1)
+    {
+        switch (request->op)
+        {
+            case REQUEST_SAMPLE:
+                result = bus_sensor->read_Sample(&pt, request->sample);
+                break;
+            case REQUEST_STATUS:
+                result = bus_sensor->read_Status(&pt, &request->value);
+                break;
+            default:
+                result = bus_sensor->trigger_Measurement(&pt, request->value);
+                break;
+        }
+
+        if (result != ASYNC_RUNNING)
+        {
+            return result;
+        }
+        if (ulTaskNotifyTake(pdTRUE, bus_timeout) == 0)
+        {
+            bus_timeouts = bus_timeouts + 1;
+            bus_sensor->abort();
+            return ASYNC_ERROR;
+        }
+    }
+}
+
+/**
+ * @brief  Bus Task
+ * @note   Serves the request queue in order and signals each requester
+ * @param  void *arg
+ * @retval None
+ */
+static void bus_Task(void *arg)
+{
+    request_t *request;
+    TaskHandle_t requester;
+
+    (void)arg;
+    while (1)
+    {
+        if (xQueueReceive(bus_queue, &request, portMAX_DELAY) == pdTRUE)
+        {
+            /*  The requester may return as soon as done is set, the request is not touched after it  */
+            requester = request->requester;
+            request->result = run_Request(request);
+            request->done = 1;
+            xTaskNotifyGiveIndexed(requester, HDC2022_RTOS_NOTIFY_INDEX);
+        }
+    }
+}
+
+/**
+ * @brief  Submit And Wait
+ * @note   The request lives on the caller stack, so the caller always waits until the bus task has marked
+ * 		it done, which is bounded by the transfer timeout. Only HDC2022_RTOS_NOTIFY_INDEX is waited on and
+ * 		a wake-up without done set waits again, other notifications of the task are left alone
+ * @param  request_t *request
+ * @retval uint8_t	:	ASYNC_DONE or ASYNC_ERROR
+ */
+static uint8_t submit(request_t *request)
+{
+    request->requester = xTaskGetCurrentTaskHandle();
+    request->result = ASYNC_ERROR;
+    request->done = 0;
+
+    /*  The give of an earlier request can arrive after its done flag was seen, it must not count here  */
+    ulTaskNotifyTakeIndexed(HDC2022_RTOS_NOTIFY_INDEX, pdTRUE, 0);
+
+    if ((bus_queue == NULL) || (xQueueSend(bus_queue, &request, portMAX_DELAY) != pdTRUE))
+    {
+        return ASYNC_ERROR;
+    }
+    while (!request->done)
+    {
+        ulTaskNotifyTakeIndexed(HDC2022_RTOS_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+    }
+
+    return request->result;
+}
+
+/**
+ * @brief  RTOS Adapter Initialization Function
+ * @note   Call before vTaskStartScheduler(), after the bus binding of the sensor (bind_Bus() on the target).
+ * 		Task and queue are allocated statically
+ * @param  HDC2022Async_c *sensor		:	Async driver, owned by the bus task from now on
+ * @param  UBaseType_t priority		:	Bus task priority, above its clients
+ * @param  TickType_t transfer_timeout	:	Completion timeout of one transfer
+ * @retval uint8_t					:	1 = OK, 0 = already started
+ */
+uint8_t HDC2022Rtos_c::Init(HDC2022Async_c *sensor, UBaseType_t priority, TickType_t transfer_timeout)
+{
+
+    if (bus_task != NULL)
+    {
+        return 0;
+    }
+
+    bus_sensor = sensor;
+    bus_timeout = transfer_timeout;
+    bus_queue = xQueueCreateStatic(HDC2022_RTOS_QUEUE, sizeof(request_t *), queue_storage, &queue_buffer);
+    bus_task = xTaskCreateStatic(bus_Task, "hdc2022", HDC2022_RTOS_STACK, NULL, priority, task_stack, &task_buffer);
+    sensor->set_Notify(notify_BusTask);
+
+    return 1;
+
+}
+
+/**
+ * @brief  Read Sample
+ * @note   Blocks the calling task only, one 4 byte burst
+ * @param  raw_sample_t *sample	:	Raw codes, valid on ASYNC_DONE
+ * @retval uint8_t			:	ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Rtos_c::read_Sample(HDC2022Async_c::raw_sample_t *sample)
+{
+
+    request_t request;
+
+    request.op = REQUEST_SAMPLE;
+    request.sample = sample;
+
+    return submit(&request);
+
+}
+
+/**
+ * @brief  Read Status
+ * @note   Blocks the calling task only
+ * @param  uint8_t *status	:	STATUS register, valid on ASYNC_DONE
+ * @retval uint8_t		:	ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Rtos_c::read_Status(uint8_t *status)
+{
+
+    request_t request;
+    uint8_t result;
+
+    request.op = REQUEST_STATUS;
+    request.sample = NULL;
+    result = submit(&request);
+    *status = request.value;
+
+    return result;
+
+}
+
+/**
+ * @brief  Trigger Measurement
+ * @note   Blocks the calling task only
+ * @param  uint8_t configuration	:	MEASUREMENT_CONFIGURATION value, MEAS_TRIG is added
+ * @retval uint8_t			:	ASYNC_DONE or ASYNC_ERROR
+ */
+uint8_t HDC2022Rtos_c::trigger_Measurement(uint8_t configuration)
+{
+
+    request_t request;
+
+    request.op = REQUEST_TRIGGER;
+    request.value = configuration;
+    request.sample = NULL;
+
+    return submit(&request);
+
+}
+
+/**
+ * @brief  Get Transfer Timeouts
+ * @note   Transfers that never completed within the Init() timeout
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t HDC2022Rtos_c::get_Timeouts()
+{
+
+    return bus_timeouts;
+
+}
+
+#endif
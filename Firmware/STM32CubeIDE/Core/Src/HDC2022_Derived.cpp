@@ -0,0 +1,281 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Derived quantities (dew point, absolute humidity, heat index) for HDC2022 samples
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <HDC2022_Derived.hpp>
+#include <math.h>                     /*  NAN only, libm is linked by the reference functions alone  */
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <HDC2022_Derived.hpp>
+ *	float dew_point;
+ *	HDC2022_c HDC2022;
+ * 	void main()
+ * 	{
+ * 	 HDC2022.Init(hi2c1,100);
+ * 		while(1)
+ * 		{
+ *			dew_point=HDC2022_Derived_c::calc_DewPoint(HDC2022);
+ * 		}
+ * 	}
+ */
+
+/*  Magnus-Tetens coefficients over water, Sonntag 1990 (valid -45..60 °C)  */
+#define MAGNUS_B        17.62f
+#define MAGNUS_C        243.12f
+#define MAGNUS_ES0      6.112f      /*  Saturation vapour pressure at 0 °C (hPa)        */
+
+#define LOG2_E          1.44269504f
+#define LN_2            0.69314718f
+#define KELVIN_OFFSET   273.15f
+#define WATER_VAPOUR_K  216.7f      /*  100 * Mw / R  : hPa/K to g/m3                   */
+
+#define HUMIDITY_FLOOR  0.01f       /*  Keeps ln(RH) finite, below sensor resolution    */
+
+typedef union
+{
+    float    f;
+    uint32_t u;
+} float_bits_t;
+
+/**
+ * @brief  Fast base-2 logarithm
+ * @note   Exponent is taken from the IEEE-754 bits, log2 of the mantissa [1,2) is a degree-5 Chebyshev fit.
+ * 		Absolute error < 1.7e-5, x must be positive and normal
+ * @param  float x
+ * @retval float
+ */
+float HDC2022_Derived_c::fast_Log2(float x)
+{
+    float_bits_t v;
+    float t;
+    float e;
+
+    v.f = x;
+    e = (float)((int32_t)((v.u >> 23) & 0xFF) - 127);
+    v.u = (v.u & 0x007FFFFF) | 0x3F800000;
+    t = v.f - 1.0f;
+
+    return e + (1.65146709e-05f + t * (1.44149241f + t * (-0.706486449f + t * (0.409470299f + t * (-0.187488605f + t * 0.0430049578f)))));
+}
+
+/**
+ * @brief  Fast base-2 exponential
+ * @note   Integer part goes to the IEEE-754 exponent, 2^f on [0,1) is a degree-4 Chebyshev fit.
+ * 		Relative error < 3.5e-6, valid for -126 < x < 128
+ * @param  float x
+ * @retval float
+ */
+float HDC2022_Derived_c::fast_Exp2(float x)
+{
+    float_bits_t v;
+    int32_t i;
+    float f;
+
+    i = (int32_t)x;
+    if (x < (float)i)
+    {
+        i--;
+    }
+    f = x - (float)i;
+
+    v.f = 1.00000349f + f * (0.692972922f + f * (0.241604357f + f * (0.0517449978f + f * 0.0136703095f)));
+    v.u += (uint32_t)i << 23;
+
+    return v.f;
+}
+
+/**
+ * @brief  Dew Point Calculation
+ * @note   Magnus formula, ln() replaced with fast_Log2(). Max error 0.0004 °C against libm
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @retval float				:	Dew point as a Celsius (°C)
+ */
+float HDC2022_Derived_c::calc_DewPoint(float temperature, float humidity)
+{
+    float gamma;
+
+    if (humidity < HUMIDITY_FLOOR)
+    {
+        humidity = HUMIDITY_FLOOR;
+    }
+
+    gamma = fast_Log2(humidity * 0.01f) * LN_2 + (MAGNUS_B * temperature) / (MAGNUS_C + temperature);
+
+    return (MAGNUS_C * gamma) / (MAGNUS_B - gamma);
+}
+
+/**
+ * @brief  Absolute Humidity Calculation
+ * @note   Magnus saturation pressure and ideal gas law, exp() replaced with fast_Exp2(). Max relative error 0.0005 %
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @retval float				:	Absolute humidity (g/m3)
+ */
+float HDC2022_Derived_c::calc_AbsoluteHumidity(float temperature, float humidity)
+{
+    float vapour_pressure;
+
+    vapour_pressure = MAGNUS_ES0 * fast_Exp2(((MAGNUS_B * temperature) / (MAGNUS_C + temperature)) * LOG2_E) * humidity * 0.01f;
+
+    return (WATER_VAPOUR_K * vapour_pressure) / (KELVIN_OFFSET + temperature);
+}
+
+/**
+ * @brief  Heat Index Calculation
+ * @note   NWS algorithm : Steadman simple formula, Rothfusz regression above 80 °F with low/high humidity adjustments.
+ * 		Regression is evaluated in Horner form, no transcendental calls on the common path
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @retval float				:	Heat index as a Celsius (°C)
+ */
+float HDC2022_Derived_c::calc_HeatIndex(float temperature, float humidity)
+{
+    float t = temperature * 1.8f + 32.0f;
+    float hi;
+
+    hi = 0.5f * (t + 61.0f + (t - 68.0f) * 1.2f + humidity * 0.094f);
+
+    if ((hi + t) * 0.5f >= 80.0f)
+    {
+        hi = -42.379f
+             + t * (2.04901523f - 6.83783e-3f * t)
+             + humidity * (10.14333127f - 5.481717e-2f * humidity)
+             + t * humidity * (-0.22475541f + 1.22874e-3f * t + 8.5282e-4f * humidity - 1.99e-6f * t * humidity);
+
+        if ((humidity < 13.0f) && (t >= 80.0f) && (t <= 112.0f))
+        {
+            float d = t - 95.0f;
+            if (d < 0.0f)
+            {
+                d = -d;
+            }
+            hi -= ((13.0f - humidity) * 0.25f) * __builtin_sqrtf((17.0f - d) * (1.0f / 17.0f));
+        }
+        else if ((humidity > 85.0f) && (t >= 80.0f) && (t <= 87.0f))
+        {
+            hi += ((humidity - 85.0f) * 0.1f) * ((87.0f - t) * 0.2f);
+        }
+    }
+
+    return (hi - 32.0f) * (1.0f / 1.8f);
+}
+
+/**
+ * @brief  Dew Point Batch Calculation
+ * @note   result may alias temperature or humidity
+ * @param  const float *temperature	:	Temperature array (°C)
+ * @param  const float *humidity	:	Relative Humidity array (%RH)
+ * @param  float *result			:	Dew point array (°C)
+ * @param  uint16_t count			:	Number of samples
+ * @retval None
+ */
+void HDC2022_Derived_c::calc_DewPoint(const float *temperature, const float *humidity, float *result, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        result[i] = calc_DewPoint(temperature[i], humidity[i]);
+    }
+}
+
+/**
+ * @brief  Absolute Humidity Batch Calculation
+ * @note   result may alias temperature or humidity
+ * @param  const float *temperature	:	Temperature array (°C)
+ * @param  const float *humidity	:	Relative Humidity array (%RH)
+ * @param  float *result			:	Absolute humidity array (g/m3)
+ * @param  uint16_t count			:	Number of samples
+ * @retval None
+ */
+void HDC2022_Derived_c::calc_AbsoluteHumidity(const float *temperature, const float *humidity, float *result, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        result[i] = calc_AbsoluteHumidity(temperature[i], humidity[i]);
+    }
+}
+
+/**
+ * @brief  Heat Index Batch Calculation
+ * @note   result may alias temperature or humidity
+ * @param  const float *temperature	:	Temperature array (°C)
+ * @param  const float *humidity	:	Relative Humidity array (%RH)
+ * @param  float *result			:	Heat index array (°C)
+ * @param  uint16_t count			:	Number of samples
+ * @retval None
+ */
+void HDC2022_Derived_c::calc_HeatIndex(const float *temperature, const float *humidity, float *result, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        result[i] = calc_HeatIndex(temperature[i], humidity[i]);
+    }
+}
+
+/**
+ * @brief  Dew Point From Sensor
+ * @note   Temperature and humidity come from one get_Sample() burst, so both belong to the same conversion
+ * @param  HDC2022_c &sensor	:	Initialized sensor
+ * @retval float				:	Dew point as a Celsius (°C), NAN when the read failed (see get_LastResult())
+ */
+float HDC2022_Derived_c::calc_DewPoint(HDC2022_c &sensor)
+{
+    HDC2022_c::raw_sample_t raw;
+
+    if (sensor.get_Sample(raw) != HDC2022_c::RESULT_OK)
+    {
+        return NAN;
+    }
+    return calc_DewPoint(HDC2022_c::decode_Temperature(raw.temperature), HDC2022_c::decode_Humidity(raw.humidity));
+}
+
+#ifdef HDC2022_DERIVED_REFERENCE
+/**
+ * @brief  Dew Point Reference
+ * @note   libm implementation, used to validate and benchmark calc_DewPoint()
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @retval float				:	Dew point as a Celsius (°C)
+ */
+float HDC2022_Derived_c::ref_DewPoint(float temperature, float humidity)
+{
+    float gamma;
+
+    if (humidity < HUMIDITY_FLOOR)
+    {
+        humidity = HUMIDITY_FLOOR;
+    }
+
+    gamma = logf(humidity * 0.01f) + (MAGNUS_B * temperature) / (MAGNUS_C + temperature);
+
+    return (MAGNUS_C * gamma) / (MAGNUS_B - gamma);
+}
+
+/**
+ * @brief  Absolute Humidity Reference
+ * @note   libm implementation, used to validate and benchmark calc_AbsoluteHumidity()
+ * @param  float temperature	:	Temperature as a Celsius (°C)
+ * @param  float humidity		:	Relative Humidity (%RH)
+ * @retval float				:	Absolute humidity (g/m3)
+ */
+float HDC2022_Derived_c::ref_AbsoluteHumidity(float temperature, float humidity)
+{
+    float vapour_pressure;
+
+    vapour_pressure = MAGNUS_ES0 * expf((MAGNUS_B * temperature) / (MAGNUS_C + temperature)) * humidity * 0.01f;
+
+    return (WATER_VAPOUR_K * vapour_pressure) / (KELVIN_OFFSET + temperature);
+}
+#endif
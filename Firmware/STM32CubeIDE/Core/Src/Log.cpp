@@ -0,0 +1,419 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Non-blocking log backend : lock-free ring drained by USART2 TX DMA
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <Log.hpp>
+#include <stdio.h>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <Log.hpp>
+ *	Log_c Log;
+ * 	void main()
+ * 	{
+ * 	 Log.Init(&huart2);
+ * 	 printf("boot %lu\n", HAL_GetTick());					// formatted on the target, returns at once
+ * 	 LOG_DEFERRED("T=%f RH=%f\n", temperature, humidity);	// 14 bytes on the wire, formatted on the host
+ * 	 LOG_TOKEN("T=%f RH=%f\n", temperature, humidity);		// same, the text does not even use flash
+ * 	}
+ */
+
+#define LOG_MASK                (LOG_BUFFER - 1)
+#define LOG_WRITER              0x00010000UL
+
+static DMA_HandleTypeDef hdma_log_tx;
+static Log_c *log_owner = NULL;
+
+/**
+ * @brief  Log Initialization Function
+ * @note   Links DMA1 Channel 7 to the UART TX and enables the DMA and USART2 interrupts.
+ * 		stdout is made unbuffered, newlib then neither allocates its stdout buffer nor holds back a line.
+ * 		Not with SYSMEM_HEAP_TRAP : newlib-nano allocates its FILE objects on the first stdio call,
+ * 		so printf() traps there and only LOG_DEFERRED / LOG_TOKEN / write() are available
+ * @param  UART_HandleTypeDef *huart	:	Initialized USART2 handle
+ * @retval None
+ */
+void Log_c::Init(UART_HandleTypeDef *huart)
+{
+
+    this->huart = huart;
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    hdma_log_tx.Instance = DMA1_Channel7;
+    hdma_log_tx.Init.Request = DMA_REQUEST_2;
+    hdma_log_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_log_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_log_tx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_log_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_log_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_log_tx.Init.Mode = DMA_NORMAL;
+    hdma_log_tx.Init.Priority = DMA_PRIORITY_LOW;
+    HAL_DMA_Init(&hdma_log_tx);
+    __HAL_LINKDMA(huart, hdmatx, hdma_log_tx);
+
+    HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+    HAL_NVIC_SetPriority(USART2_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(USART2_IRQn);
+
+    log_owner = this;
+#if !SYSMEM_HEAP_TRAP
+    setvbuf(stdout, NULL, _IONBF, 0);
+#endif
+
+}
+
+/**
+ * @brief  Write Bytes
+ * @note   Any context, never waits. All or nothing : a write that does not fit is dropped
+ * @param  const char *data
+ * @param  int len
+ * @retval int		:	len when accepted, 0 when dropped
+ */
+int Log_c::write(const char *data, int len)
+{
+
+    int32_t at;
+
+    if ((len <= 0) || (len >= LOG_BUFFER))
+    {
+        return 0;
+    }
+
+    at = reserve((uint16_t)len);
+    if (at < 0)
+    {
+        return 0;
+    }
+    copy((uint16_t)at, (const uint8_t *)data, (uint16_t)len);
+    commit();
+
+    return len;
+
+}
+
+/**
+ * @brief  Get Pending Bytes
+ * @note   Bytes in the ring not yet handed over to the DMA, plus the transfer in flight
+ * @param  None
+ * @retval uint16_t
+ */
+uint16_t Log_c::get_Pending()
+{
+
+    return (uint16_t)((state & 0xFFFF) - tail);
+
+}
+
+/**
+ * @brief  Flush
+ * @note   Thread context, e.g. before a reset. Waits until the ring is empty
+ * @param  uint32_t timeout_ms
+ * @retval uint8_t	:	1 = empty, 0 = timeout
+ */
+uint8_t Log_c::flush(uint32_t timeout_ms)
+{
+
+    uint32_t start = HAL_GetTick();
+
+    kick();
+    while (get_Pending() != 0)
+    {
+        if ((HAL_GetTick() - start) > timeout_ms)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+
+}
+
+/**
+ * @brief  Get Log Statistics
+ * @note   None
+ * @param  None
+ * @retval const log_stats_t &
+ */
+const Log_c::log_stats_t &Log_c::get_Statistics()
+{
+
+    return stats;
+
+}
+
+/**
+ * @brief  Get UART Handle
+ * @note   None
+ * @param  None
+ * @retval UART_HandleTypeDef *
+ */
+UART_HandleTypeDef *Log_c::get_Handle()
+{
+
+    return huart;
+
+}
+
+/**
+ * @brief  TX DMA Complete
+ * @note   Called from HAL_UART_TxCpltCallback(), frees the sent bytes and starts the next transfer.
+ * 		Runs in the interrupt on purpose, not as a Scheduler_c event : it only moves tail and kick()
+ * 		starts at most one HAL_UART_Transmit_DMA(), flush() and everything logged before
+ * 		Scheduler_c::run() depend on it, and a posted restart would leave the UART idle for one
+ * 		dispatch per transfer
+ * @param  None
+ * @retval None
+ */
+RAM2_FUNC void Log_c::tx_Complete()
+{
+
+    tail = (uint16_t)(tail + tx_len);
+    tx_len = 0;
+    __DMB();
+    tx_busy = 0;
+    kick();
+
+}
+
+/**
+ * @brief  Reserve Ring Space
+ * @note   Lock-free, advances head and counts the writer in one exclusive store
+ * @param  uint16_t len
+ * @retval int32_t	:	Ring index of the reserved space, -1 = ring full
+ */
+RAM2_FUNC int32_t Log_c::reserve(uint16_t len)
+{
+
+    uint32_t current;
+    uint16_t head;
+    uint16_t pending;
+
+    do
+    {
+        current = __LDREXW(&state);
+        head = (uint16_t)current;
+        pending = (uint16_t)(head - tail);
+        if ((uint16_t)(LOG_BUFFER - pending) < len)
+        {
+            __CLREX();
+            stats.dropped += len;
+            return -1;
+        }
+    } while (__STREXW(((current + LOG_WRITER) & 0xFFFF0000UL) | (uint16_t)(head + len), &state));
+
+    stats.written += len;
+    if ((uint16_t)(pending + len) > stats.worst_pending)
+    {
+        stats.worst_pending = (uint16_t)(pending + len);
+    }
+
+    return head;
+
+}
+
+/**
+ * @brief  Commit Reserved Space
+ * @note   Lock-free, the last active writer makes everything up to head visible and starts the DMA
+ * @param  None
+ * @retval None
+ */
+RAM2_FUNC void Log_c::commit()
+{
+
+    uint32_t current;
+
+    __DMB();
+    do
+    {
+        current = __LDREXW(&state);
+    } while (__STREXW(current - LOG_WRITER, &state));
+
+    kick();
+
+}
+
+/**
+ * @brief  Copy Into Ring
+ * @note   Handles the wrap
+ * @param  uint16_t at		:	Free-running ring index
+ * @param  const uint8_t *data
+ * @param  uint16_t len
+ * @retval None
+ */
+RAM2_FUNC void Log_c::copy(uint16_t at, const uint8_t *data, uint16_t len)
+{
+
+    uint16_t offset = at & LOG_MASK;
+    uint16_t first = (uint16_t)(LOG_BUFFER - offset);
+
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&buffer[offset], data, first);
+    memcpy(&buffer[0], data + first, len - first);
+
+}
+
+/**
+ * @brief  Write Record
+ * @note   Mark, word count, ID, arguments. One reservation, so a record is never split by another writer
+ * @param  uint8_t mark			:	LOG_RECORD_MARK, LOG_TOKEN32_MARK or LOG_TOKEN16_MARK
+ * @param  const uint32_t *words	:	ID (format address or token) and packed arguments
+ * @param  uint8_t count			:	Number of words
+ * @param  uint8_t id_bytes		:	Bytes of the ID on the wire, 2 or 4
+ * @retval None
+ */
+RAM2_FUNC void Log_c::write_Record(uint8_t mark, const uint32_t *words, uint8_t count, uint8_t id_bytes)
+{
+
+    uint32_t start = DWT->CYCCNT;
+    uint8_t header[2] = { mark, count };
+    uint16_t len = (uint16_t)(2 + id_bytes + 4 * (count - 1));
+    int32_t at = reserve(len);
+
+    if (at < 0)
+    {
+        return;
+    }
+    copy((uint16_t)at, header, 2);
+    copy((uint16_t)(at + 2), (const uint8_t *)words, id_bytes);
+    copy((uint16_t)(at + 2 + id_bytes), (const uint8_t *)&words[1], (uint16_t)(4 * (count - 1)));
+    stats.records++;
+    stats.last_record_cycles = DWT->CYCCNT - start;
+    if (stats.last_record_cycles > stats.worst_record_cycles)
+    {
+        stats.worst_record_cycles = stats.last_record_cycles;
+    }
+    commit();
+
+}
+
+/**
+ * @brief  Start TX DMA
+ * @note   Any context. Only the owner of tx_busy starts a transfer, a caller that loses the race leaves it
+ * 		to the owner, which checks for new data again after releasing
+ * @param  None
+ * @retval None
+ */
+RAM2_FUNC void Log_c::kick()
+{
+
+    uint32_t current;
+    uint16_t head;
+    uint16_t len;
+
+    while (1)
+    {
+        do
+        {
+            if (__LDREXW(&tx_busy))
+            {
+                __CLREX();
+                return;
+            }
+        } while (__STREXW(1, &tx_busy));
+        __DMB();
+
+        current = state;
+        head = (uint16_t)current;
+        if (((current & 0xFFFF0000UL) == 0) && (head != tail) && (huart != NULL))
+        {
+            len = (uint16_t)(head - tail);
+            if (len > LOG_BUFFER - (tail & LOG_MASK))
+            {
+                len = (uint16_t)(LOG_BUFFER - (tail & LOG_MASK));
+            }
+            tx_len = len;
+            if (HAL_UART_Transmit_DMA(huart, &buffer[tail & LOG_MASK], len) == HAL_OK)
+            {
+                stats.transfers++;
+                return;
+            }
+
+            /*  UART busy elsewhere (re-init, locked by the interrupted context), the next write retries  */
+            tx_len = 0;
+            __DMB();
+            tx_busy = 0;
+            return;
+        }
+
+        __DMB();
+        tx_busy = 0;
+
+        current = state;
+        if (((current & 0xFFFF0000UL) != 0) || ((uint16_t)current == tail) || (huart == NULL))
+        {
+            return;
+        }
+    }
+
+}
+
+/**
+ * @brief  Retarget Standard Output
+ * @note   Overrides the weak _write() of syscalls.c, stdout and stderr go to the ring
+ */
+extern "C" int _write(int file, char *ptr, int len)
+{
+    if ((log_owner == NULL) || ((file != 1) && (file != 2)))
+    {
+        return len;
+    }
+    log_owner->write(ptr, len);
+
+    return len;
+}
+
+extern "C" RAM2_FUNC void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (log_owner && (huart->hdmatx == &hdma_log_tx))
+    {
+        log_owner->tx_Complete();
+    }
+}
+
+extern "C" void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (log_owner && (huart->hdmatx == &hdma_log_tx) && (huart->gState == HAL_UART_STATE_READY))
+    {
+        log_owner->tx_Complete();
+    }
+}
+
+/**
+ * @brief  DMA1 Channel 7 Interrupt Function
+ * @note   Called from DMA1_Channel7_IRQHandler()
+ * @param  None
+ * @retval None
+ */
+extern "C" RAM2_FUNC void Log_DMA_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_log_tx);
+}
+
+/**
+ * @brief  USART2 Interrupt Function
+ * @note   Called from USART2_IRQHandler(), the HAL ends a DMA transmission on the TC interrupt
+ * @param  None
+ * @retval None
+ */
+extern "C" void Log_UART_IRQHandler(void)
+{
+    if (log_owner)
+    {
+        HAL_UART_IRQHandler(log_owner->get_Handle());
+    }
+}
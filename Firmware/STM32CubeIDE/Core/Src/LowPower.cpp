@@ -0,0 +1,201 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        STOP2 acquisition runtime, wake-up on HDC2022 DRDY (EXTI) or Sampler_c deadline
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <LowPower.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <LowPower.hpp>
+ *	LowPower_c LowPower;
+ * 	void main()
+ * 	{
+ * 	 HDC2022.Init(hi2c1,10);
+ * 	 HDC2022.INTERRUPT_ENABLE.bits.DRDY_ENABLE=1;
+ * 	 HDC2022.set_Interrupt();
+ * 	 HDC2022.arm_Alarm(HDC2022_c::RATE_1HZ, 1, 0);
+ * 	 LowPower.Init(&Sampler);
+ * 	 Sampler.Init(1000);
+ * 		while(1)
+ * 		{
+ *			LowPower.set_Deadline(1500);
+ *			LowPower.sleep();
+ *			if(drdy)
+ *			{
+ *				temperature=HDC2022.get_Temperature();
+ *				LowPower.mark_Sample();
+ *			}
+ * 		}
+ * 	}
+ */
+
+/**
+ * @brief  Low Power Runtime Initialization Function
+ * @note   Selects HSI16 as STOP wake-up clock. The deadline runs on the timebase once its Init() is
+ * 		done. Use after SystemClock_Config() and the HDC2022 DRDY/INT pin setup
+ * @param  Sampler_c *timebase	:	Sampler that owns LPTIM1
+ * @retval None
+ */
+void LowPower_c::Init(Sampler_c *timebase)
+{
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    this->timebase = timebase;
+
+    __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_HSI);
+#ifdef DEBUG
+    HAL_DBGMCU_EnableDBGStopMode();
+#endif
+
+    wake_stamp = DWT->CYCCNT;
+
+}
+
+/**
+ * @brief  Set Wake-up Deadline
+ * @note   One-shot, the next sleep() returns after ms at the latest even if DRDY never comes.
+ * 		Sampler_c::set_Wakeup(), no deadline while the sampler is stopped
+ * @param  uint16_t ms	:	Deadline from now (1..65535 ms)
+ * @retval None
+ */
+void LowPower_c::set_Deadline(uint16_t ms)
+{
+
+    timebase->set_Wakeup(ms);
+
+}
+
+/**
+ * @brief  Enter STOP2 Until DRDY Or Deadline
+ * @note   SysTick is suspended while stopped, HAL_GetTick() does not advance during STOP2.
+ * 		The sampling instants of the timebase wake the core as well. Safe to call with interrupts masked (Scheduler_c idle hook), the wake-up interrupt runs afterwards
+ * @param  None
+ * @retval None
+ */
+void LowPower_c::sleep()
+{
+
+    uint8_t lprun = READ_BIT(PWR->CR1, PWR_CR1_LPR) ? 1 : 0;
+
+    stats.awake_cycles += DWT->CYCCNT - wake_stamp;
+
+    if (lprun)
+    {
+        HAL_PWREx_DisableLowPowerRunMode();     /*  STOP2 can not be entered from Low-power run  */
+    }
+    HAL_SuspendTick();
+    HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+    wake_stamp = DWT->CYCCNT;
+    restore_Clock();
+    HAL_ResumeTick();
+    if (lprun)
+    {
+        HAL_PWREx_EnableLowPowerRunMode();
+    }
+
+    stats.wakeups++;
+    if (timebase->take_Wakeup())                /*  Interrupts may still be masked by the caller  */
+    {
+        stats.deadline_wakeups++;
+    }
+
+}
+
+/**
+ * @brief  Mark Sample Complete
+ * @note   Call after the burst read, records the wake-to-sample latency including the clock restore
+ * @param  None
+ * @retval None
+ */
+void LowPower_c::mark_Sample()
+{
+
+    stats.last_latency = DWT->CYCCNT - wake_stamp;
+    if (stats.last_latency > stats.worst_latency)
+    {
+        stats.worst_latency = stats.last_latency;
+    }
+    stats.samples++;
+
+}
+
+/**
+ * @brief  Estimated Duty Cycle
+ * @note   Average awake time per wake-up against the sampling period of the configured rate,
+ * 		e.g. get_DutyCycle(1000) for HDC2022_c::RATE_1HZ
+ * @param  uint32_t period_ms	:	Sampling period (ms)
+ * @retval uint32_t			:	Awake fraction in ppm
+ */
+uint32_t LowPower_c::get_DutyCycle(uint32_t period_ms)
+{
+
+    uint64_t awake_us;
+
+    if ((stats.wakeups == 0) || (period_ms == 0))
+    {
+        return 0;
+    }
+
+    awake_us = stats.awake_cycles / stats.wakeups / (SystemCoreClock / 1000000U);
+
+    return (uint32_t)((awake_us * 1000U) / period_ms);
+
+}
+
+/**
+ * @brief  Get Runtime Statistics
+ * @note   Cycle values / (SystemCoreClock / 1000000) give microseconds
+ * @param  None
+ * @retval const lp_stats_t &
+ */
+const LowPower_c::lp_stats_t &LowPower_c::get_Statistics()
+{
+
+    return stats;
+
+}
+
+/**
+ * @brief  Restore System Clock After STOP2
+ * @note   The core wakes on HSI16, PLL configuration is retained so only PLLON and SW are needed.
+ * 		Much shorter than a full SystemClock_Config(). A wake-up on MSI means ClockGovernor_c runs
+ * 		the low-power mode with the PLL off, only HSI16 is restarted then : STOP cleared HSION and
+ * 		USART2 takes its kernel clock from it
+ * @param  None
+ * @retval None
+ */
+void LowPower_c::restore_Clock()
+{
+
+    if (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_MSI)
+    {
+        __HAL_RCC_HSI_ENABLE();
+        while (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIRDY) == 0)
+        {
+        }
+        return;
+    }
+
+    __HAL_RCC_PLL_ENABLE();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) == 0)
+    {
+    }
+    __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK)
+    {
+    }
+
+}
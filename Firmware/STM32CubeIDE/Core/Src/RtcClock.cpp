@@ -0,0 +1,291 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        RTC wall-clock timestamp service, LSE backed, 1/256 s sub-second field
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <RtcClock.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <RtcClock.hpp>
+ *	RtcClock_c Rtc;
+ * 	void main()
+ * 	{
+ * 	 if(Rtc.Init(RtcClock_c::parse_BuildTime(__DATE__, __TIME__)) == 0) { no LSE }
+ * 	 Rtc.set_Time(1792368000);			// optional, e.g. from the host over UART
+ * 		while(1)
+ * 		{
+ *			sample.wall = Rtc.get_Timestamp();
+ * 		}
+ * 	}
+ */
+
+#define RTC_UNLOCK()        do { RTC->WPR = 0xCA; RTC->WPR = 0x53; } while (0)
+#define RTC_LOCK()          (RTC->WPR = 0xFF)
+
+#define BCD2(v, pos)        ((((v) >> ((pos) + 4)) & 0x0F) * 10 + (((v) >> (pos)) & 0x0F))
+#define DIGIT2(p)           ((((p)[0] == ' ') ? 0U : (uint32_t)((p)[0] - '0')) * 10U + (uint32_t)((p)[1] - '0'))
+#define DAYS_TO_2000        10957U      /*  1970-01-01 to 2000-01-01                               */
+
+/**
+ * @brief  Days From Civil Date
+ * @note   Proleptic Gregorian calendar, days since 1970-01-01, valid from 1970
+ * @param  uint32_t year		:	e.g. 2026
+ * @param  uint32_t month		:	1..12
+ * @param  uint32_t day		:	1..31
+ * @retval uint32_t
+ */
+uint32_t RtcClock_c::days_FromCivil(uint32_t year, uint32_t month, uint32_t day)
+{
+
+    uint32_t era, yoe, doy, doe;
+
+    year -= (month <= 2) ? 1 : 0;
+    era = year / 400;
+    yoe = year - era * 400;
+    doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + doe - 719468;
+
+}
+
+/**
+ * @brief  Civil Date From Days
+ * @note   Inverse of days_FromCivil()
+ * @param  uint32_t days		:	Days since 1970-01-01
+ * @param  uint32_t *year
+ * @param  uint32_t *month	:	1..12
+ * @param  uint32_t *day		:	1..31
+ * @retval None
+ */
+void RtcClock_c::civil_FromDays(uint32_t days, uint32_t *year, uint32_t *month, uint32_t *day)
+{
+
+    uint32_t z = days + 719468;
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *month = (mp < 10) ? mp + 3 : mp - 9;
+    *year = yoe + era * 400 + ((*month <= 2) ? 1 : 0);
+
+}
+
+/**
+ * @brief  Decode RTC_TR
+ * @note   24 hour format
+ * @param  uint32_t tr	:	RTC_TR value
+ * @retval uint32_t		:	Seconds since midnight
+ */
+uint32_t RtcClock_c::decode_Time(uint32_t tr)
+{
+
+    return BCD2(tr, RTC_TR_HU_Pos) * 3600U + BCD2(tr, RTC_TR_MNU_Pos) * 60U + BCD2(tr, RTC_TR_SU_Pos);
+
+}
+
+/**
+ * @brief  Decode RTC_DR
+ * @note   Years 00..99 are 2000..2099
+ * @param  uint32_t dr	:	RTC_DR value
+ * @retval uint32_t		:	Unix time of midnight
+ */
+uint32_t RtcClock_c::decode_Date(uint32_t dr)
+{
+
+    uint32_t year = 2000 + BCD2(dr, RTC_DR_YU_Pos);
+    uint32_t month = ((dr >> RTC_DR_MT_Pos) & 0x01) * 10 + ((dr >> RTC_DR_MU_Pos) & 0x0F);
+    uint32_t day = BCD2(dr, RTC_DR_DU_Pos);
+
+    return days_FromCivil(year, month, day) * 86400U;
+
+}
+
+/**
+ * @brief  Parse Build Time
+ * @note   __DATE__ ("Oct 19 2026") and __TIME__ ("14:05:09") to Unix time. Both are local time of the
+ * 		build machine, subtract its UTC offset (RTC_BUILD_UTC_OFFSET)
+ * @param  const char *date	:	__DATE__
+ * @param  const char *time	:	__TIME__
+ * @retval uint32_t			:	Unix time (s)
+ */
+uint32_t RtcClock_c::parse_BuildTime(const char *date, const char *time)
+{
+
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    uint32_t month = 0;
+
+    while ((month < 11) && ((months[month * 3] != date[0]) || (months[month * 3 + 1] != date[1])
+                            || (months[month * 3 + 2] != date[2])))
+    {
+        month++;
+    }
+
+    return days_FromCivil(DIGIT2(&date[7]) * 100U + DIGIT2(&date[9]), month + 1, DIGIT2(&date[4])) * 86400U
+        + DIGIT2(&time[0]) * 3600U + DIGIT2(&time[3]) * 60U + DIGIT2(&time[6]);
+
+}
+
+/**
+ * @brief  RTC Initialization Function
+ * @note   Starts LSE and the RTC only on the first power-up of the backup domain, a running calendar is kept.
+ * 		A calendar that was never set (INITS clear) starts from seed_seconds.
+ * 		Use after SystemClock_Config(), HAL_GetTick() bounds the LSE start-up
+ * @param  uint32_t seed_seconds	:	Unix time for a calendar that was never set, 0 = leave at 2000-01-01
+ * @retval uint8_t				:	1 = OK, 0 = LSE did not start
+ */
+uint8_t RtcClock_c::Init(uint32_t seed_seconds)
+{
+
+    uint8_t unset;
+
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+
+    if ((RCC->BDCR & RCC_BDCR_RTCEN) == 0)
+    {
+        uint32_t start = HAL_GetTick();
+
+        __HAL_RCC_LSEDRIVE_CONFIG(RCC_LSEDRIVE_LOW);
+        __HAL_RCC_LSE_CONFIG(RCC_LSE_ON);
+        while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY) == 0)
+        {
+            if ((HAL_GetTick() - start) > RCC_LSE_TIMEOUT_VALUE)
+            {
+                return 0;
+            }
+        }
+        __HAL_RCC_RTC_CONFIG(RCC_RTCCLKSOURCE_LSE);
+        __HAL_RCC_RTC_ENABLE();
+    }
+
+    RTC_UNLOCK();
+    RTC->CR |= RTC_CR_BYPSHAD;
+    unset = ((RTC->ISR & RTC_ISR_INITS) == 0);
+    if (unset)
+    {
+        RTC->ISR |= RTC_ISR_INIT;
+        while ((RTC->ISR & RTC_ISR_INITF) == 0)
+        {
+        }
+        RTC->PRER = RTC_PREDIV_S;
+        RTC->PRER |= RTC_PREDIV_A << RTC_PRER_PREDIV_A_Pos;
+        RTC->ISR &= ~RTC_ISR_INIT;
+    }
+    RTC_LOCK();
+
+    cache_dr = 0xFFFFFFFF;
+    if (unset && (seed_seconds != 0))
+    {
+        set_Time(seed_seconds);
+    }
+
+    return 1;
+
+}
+
+/**
+ * @brief  Set Wall Clock
+ * @note   Sub-seconds restart from 0
+ * @param  uint32_t unix_seconds	:	Unix time, 2000-01-01 .. 2099-12-31
+ * @retval uint8_t				:	1 = OK, 0 = out of range
+ */
+uint8_t RtcClock_c::set_Time(uint32_t unix_seconds)
+{
+
+    uint32_t days = unix_seconds / 86400U;
+    uint32_t sod = unix_seconds % 86400U;
+    uint32_t year, month, day, weekday, h, m, s;
+
+    if ((days < DAYS_TO_2000) || (days > days_FromCivil(2099, 12, 31)))
+    {
+        return 0;
+    }
+
+    civil_FromDays(days, &year, &month, &day);
+    year -= 2000;
+    weekday = ((days + 3) % 7) + 1;             /*  1970-01-01 is a Thursday, 1 = Monday   */
+    h = sod / 3600U;
+    m = (sod / 60U) % 60U;
+    s = sod % 60U;
+
+    RTC_UNLOCK();
+    RTC->ISR |= RTC_ISR_INIT;
+    while ((RTC->ISR & RTC_ISR_INITF) == 0)
+    {
+    }
+    RTC->TR = ((h / 10) << RTC_TR_HT_Pos) | ((h % 10) << RTC_TR_HU_Pos) | ((m / 10) << RTC_TR_MNT_Pos)
+        | ((m % 10) << RTC_TR_MNU_Pos) | ((s / 10) << RTC_TR_ST_Pos) | ((s % 10) << RTC_TR_SU_Pos);
+    RTC->DR = ((year / 10) << RTC_DR_YT_Pos) | ((year % 10) << RTC_DR_YU_Pos) | (weekday << RTC_DR_WDU_Pos)
+        | ((month / 10) << RTC_DR_MT_Pos) | ((month % 10) << RTC_DR_MU_Pos) | ((day / 10) << RTC_DR_DT_Pos)
+        | ((day % 10) << RTC_DR_DU_Pos);
+    RTC->ISR &= ~RTC_ISR_INIT;
+    RTC_LOCK();
+
+    cache_dr = 0xFFFFFFFF;
+
+    return 1;
+
+}
+
+/**
+ * @brief  Get Wall-Clock Timestamp
+ * @note   Counters are read directly (BYPSHAD) until two passes agree, usually one repeat at most.
+ * 		The date decode is cached, a normal call costs one BCD time decode
+ * @param  None
+ * @retval rtc_stamp_t
+ */
+RtcClock_c::rtc_stamp_t RtcClock_c::get_Timestamp()
+{
+
+    rtc_stamp_t stamp;
+    uint32_t ssr, tr, dr;
+
+    do
+    {
+        ssr = RTC->SSR;
+        tr = RTC->TR;
+        dr = RTC->DR;
+    } while ((ssr != RTC->SSR) || (tr != RTC->TR) || (dr != RTC->DR));
+
+    if (dr != cache_dr)
+    {
+        cache_midnight = decode_Date(dr);
+        cache_dr = dr;
+    }
+
+    stamp.seconds = cache_midnight + decode_Time(tr);
+    stamp.subseconds = (ssr <= RTC_PREDIV_S) ? (uint16_t)(RTC_PREDIV_S - ssr) : 0;
+
+    return stamp;
+
+}
+
+/**
+ * @brief  Get Wall-Clock Milliseconds
+ * @note   Unix time in ms, 3.9 ms resolution
+ * @param  None
+ * @retval uint64_t
+ */
+uint64_t RtcClock_c::get_Milliseconds()
+{
+
+    rtc_stamp_t stamp = get_Timestamp();
+
+    return (uint64_t)stamp.seconds * 1000U + ((uint32_t)stamp.subseconds * 1000U) / (RTC_PREDIV_S + 1);
+
+}
@@ -0,0 +1,314 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Streaming time-series codec for HDC2022 sample sequences (UART link and flash log)
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <SampleCodec.hpp>
+#include <string.h>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <SampleCodec.hpp>
+ *	SampleEncoder_c Encoder;
+ *	uint8_t page[2048];
+ *	uint16_t used = 0;
+ * 	void main()
+ * 	{
+ * 	 Encoder.Init(2);
+ * 		while(1)
+ * 		{
+ *			n = Encoder.encode(&sample, &page[used], sizeof(page) - used);
+ *			if(n == 0)
+ *			{
+ *				flash_write(page, used); used = 0; Encoder.Reset();
+ *				n = Encoder.encode(&sample, page, sizeof(page));
+ *			}
+ *			used += n;
+ * 		}
+ * 	}
+ */
+
+#define RECORD_LONG     0x80
+
+/**
+ * @brief  Zig-zag Encode
+ * @note   Maps small signed values to small unsigned values : 0,-1,1,-2 -> 0,1,2,3
+ * @param  int32_t v
+ * @retval uint32_t
+ */
+static inline uint32_t zigzag_Encode(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+/**
+ * @brief  Zig-zag Decode
+ * @note   None
+ * @param  uint32_t v
+ * @retval int32_t
+ */
+static inline int32_t zigzag_Decode(uint32_t v)
+{
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+/**
+ * @brief  Write Unsigned Varint
+ * @note   7 bits per byte, LSB first, at most 5 bytes
+ * @param  uint32_t v
+ * @param  uint8_t *out	:	Destination, must have 5 bytes free
+ * @retval uint8_t		:	Bytes written
+ */
+static uint8_t varint_Put(uint32_t v, uint8_t *out)
+{
+    uint8_t n = 0;
+
+    while (v >= 0x80)
+    {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+
+    return n;
+}
+
+/**
+ * @brief  Read Unsigned Varint
+ * @note   None
+ * @param  const uint8_t *in	:	Source
+ * @param  uint16_t size		:	Source length
+ * @param  uint16_t *pos		:	Read position, advanced on success
+ * @param  uint32_t *v		:	Decoded value
+ * @retval uint8_t			:	1 = OK, 0 = truncated or overlong
+ */
+static uint8_t varint_Get(const uint8_t *in, uint16_t size, uint16_t *pos, uint32_t *v)
+{
+    uint32_t result = 0;
+    uint16_t p = *pos;
+
+    for (uint8_t shift = 0; shift < 35; shift += 7)
+    {
+        if (p >= size)
+        {
+            return 0;
+        }
+        result |= (uint32_t)(in[p] & 0x7F) << shift;
+        if ((in[p++] & 0x80) == 0)
+        {
+            *pos = p;
+            *v = result;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  Encoder Initialization Function
+ * @note   shift drops the always-zero low bits of reduced resolution codes
+ * @param  uint8_t shift	:	2 for 14 bit, 5 for 11 bit, 7 for 9 bit, 0 to keep all 16 bits
+ * @retval None
+ */
+void SampleEncoder_c::Init(uint8_t shift)
+{
+
+    this->shift = shift;
+    Reset();
+
+}
+
+/**
+ * @brief  Start a New Block
+ * @note   Next encode() writes the block header and an absolute sample
+ * @param  None
+ * @retval None
+ */
+void SampleEncoder_c::Reset()
+{
+
+    started = 0;
+    count = 0;
+    prev_timestamp = 0;
+    prev_period = 0;
+    prev_temperature = 0;
+    prev_humidity = 0;
+
+}
+
+/**
+ * @brief  Encode One Sample
+ * @note   Encoder state only advances when the record fits, so on 0 the caller flushes the block,
+ * 		calls Reset() and encodes the same sample again
+ * @param  const codec_sample_t *sample	:	Sample to append
+ * @param  uint8_t *out				:	Destination
+ * @param  uint16_t size				:	Free bytes in destination
+ * @retval uint16_t					:	Bytes written, 0 = does not fit
+ */
+uint16_t SampleEncoder_c::encode(const codec_sample_t *sample, uint8_t *out, uint16_t size)
+{
+
+    uint8_t record[CODEC_MAX_RECORD];
+    uint8_t n = 0;
+    uint16_t temperature = sample->temperature >> shift;
+    uint16_t humidity = sample->humidity >> shift;
+    uint32_t period = 0;
+
+    if (!started)
+    {
+        record[n++] = shift;
+        n += varint_Put(sample->timestamp, &record[n]);
+        n += varint_Put(temperature, &record[n]);
+        n += varint_Put(humidity, &record[n]);
+    }
+    else
+    {
+        uint32_t zt, zh;
+        int32_t dod;
+
+        period = sample->timestamp - prev_timestamp;
+        dod = (int32_t)(period - prev_period);
+        zt = zigzag_Encode((int32_t)temperature - (int32_t)prev_temperature);
+        zh = zigzag_Encode((int32_t)humidity - (int32_t)prev_humidity);
+
+        if ((dod == 0) && (zt < 16) && (zh < 8))
+        {
+            record[n++] = (uint8_t)((zt << 3) | zh);
+        }
+        else
+        {
+            record[n++] = RECORD_LONG;
+            n += varint_Put(zigzag_Encode(dod), &record[n]);
+            n += varint_Put(zt, &record[n]);
+            n += varint_Put(zh, &record[n]);
+        }
+    }
+
+    if (n > size)
+    {
+        return 0;
+    }
+    memcpy(out, record, n);
+
+    prev_period = started ? period : 0;
+    prev_timestamp = sample->timestamp;
+    prev_temperature = temperature;
+    prev_humidity = humidity;
+    started = 1;
+    count++;
+
+    return n;
+
+}
+
+/**
+ * @brief  Get Encoded Sample Count
+ * @note   Samples in the current block
+ * @param  None
+ * @retval uint32_t
+ */
+uint32_t SampleEncoder_c::get_Count()
+{
+
+    return count;
+
+}
+
+/**
+ * @brief  Start Decoding a New Block
+ * @note   None
+ * @param  None
+ * @retval None
+ */
+void SampleDecoder_c::Reset()
+{
+
+    shift = 0;
+    state = 0;
+    prev_timestamp = 0;
+    prev_period = 0;
+    prev_temperature = 0;
+    prev_humidity = 0;
+
+}
+
+/**
+ * @brief  Decode One Sample
+ * @note   Nothing is consumed when the record is incomplete, feed more bytes and call again
+ * @param  const uint8_t *in			:	Encoded bytes
+ * @param  uint16_t size				:	Available bytes
+ * @param  uint16_t *consumed			:	Bytes used by the decoded record
+ * @param  codec_sample_t *sample		:	Decoded sample
+ * @retval uint8_t					:	1 = sample decoded, 0 = need more bytes or corrupt block
+ */
+uint8_t SampleDecoder_c::decode(const uint8_t *in, uint16_t size, uint16_t *consumed, codec_sample_t *sample)
+{
+
+    uint16_t pos = 0;
+    uint32_t timestamp, temperature, humidity;
+
+    *consumed = 0;
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    if (state == 0)
+    {
+        uint8_t s = in[pos++];
+
+        if ((s > 15) || !varint_Get(in, size, &pos, &timestamp) || !varint_Get(in, size, &pos, &temperature)
+            || !varint_Get(in, size, &pos, &humidity))
+        {
+            return 0;
+        }
+        shift = s;
+        prev_period = 0;
+    }
+    else if (in[0] & RECORD_LONG)
+    {
+        uint32_t zd, zt, zh;
+
+        pos++;
+        if (!varint_Get(in, size, &pos, &zd) || !varint_Get(in, size, &pos, &zt) || !varint_Get(in, size, &pos, &zh))
+        {
+            return 0;
+        }
+        prev_period += (uint32_t)zigzag_Decode(zd);
+        timestamp = prev_timestamp + prev_period;
+        temperature = (uint16_t)(prev_temperature + zigzag_Decode(zt));
+        humidity = (uint16_t)(prev_humidity + zigzag_Decode(zh));
+    }
+    else
+    {
+        pos++;
+        timestamp = prev_timestamp + prev_period;
+        temperature = (uint16_t)(prev_temperature + zigzag_Decode(in[0] >> 3));
+        humidity = (uint16_t)(prev_humidity + zigzag_Decode(in[0] & 0x07));
+    }
+
+    state = 1;
+
+    prev_timestamp = timestamp;
+    prev_temperature = (uint16_t)temperature;
+    prev_humidity = (uint16_t)humidity;
+
+    sample->timestamp = timestamp;
+    sample->temperature = (uint16_t)(temperature << shift);
+    sample->humidity = (uint16_t)(humidity << shift);
+    *consumed = pos;
+
+    return 1;
+
+}
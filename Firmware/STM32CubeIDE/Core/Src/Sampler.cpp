@@ -0,0 +1,419 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Hardware-timed sampling clock with 64 bit timestamps and jitter instrumentation
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <Sampler.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <Sampler.hpp>
+ *	Sampler_c Sampler;
+ *	Sampler_c::sample_t sample;
+ * 	void main()
+ * 	{
+ * 	 HDC2022.Init(hi2c1,10);
+ * 	 Sampler.Init(1000);
+ * 		while(1)
+ * 		{
+ *			LowPower.sleep();
+ *			if(Sampler.poll_Trigger(&sample.timestamp))
+ *			{
+ *				HDC2022.trigger_Measurement();
+ *				Sampler.mark_Triggered();
+ *			}
+ *			if(HDC2022.get_Status() & 0x80)
+ *			{
+ *				HDC2022.get_Sample(sample.raw);
+ *			}
+ * 		}
+ * 	}
+ */
+
+static volatile uint32_t overflows = 0;
+static volatile uint8_t  pending = 0;
+static volatile uint64_t trigger_stamp = 0;
+static volatile uint32_t overrun_count = 0;
+static volatile uint64_t wakeup_stamp = 0;
+static volatile uint8_t  wakeup_hit = 0;
+static uint64_t next_trigger = 0;
+static uint32_t period_ticks = 0;
+static uint16_t loaded_compare = 0;
+static void (*notify_hook)(void) = NULL;
+
+/**
+ * @brief  Read LPTIM1 Counter
+ * @note   The counter runs on the asynchronous LSI domain, two equal consecutive reads are required
+ * @param  None
+ * @retval uint16_t
+ */
+static uint16_t read_Counter(void)
+{
+    uint16_t a, b;
+
+    do
+    {
+        a = (uint16_t)LPTIM1->CNT;
+        b = (uint16_t)LPTIM1->CNT;
+    } while (a != b);
+
+    return a;
+}
+
+/**
+ * @brief  Read Extended Counter
+ * @note   Safe from thread and interrupt context, a wrap whose ARRM is still pending is accounted for
+ * @param  None
+ * @retval uint64_t	:	Ticks since Init()
+ */
+static uint64_t read_Timestamp(void)
+{
+    uint32_t ovf, wrap;
+    uint16_t cnt;
+
+    do
+    {
+        ovf = overflows;
+        cnt = read_Counter();
+        wrap = ((LPTIM1->ISR & LPTIM_ISR_ARRM) && (cnt < 0x8000U)) ? 1 : 0;
+    } while (ovf != overflows);
+
+    return ((uint64_t)(ovf + wrap) << 16) | cnt;
+}
+
+/**
+ * @brief  Load Compare Register
+ * @note   Aims CMP at the earlier of the grid instant and the pending wake-up. A write waits for the previous
+ * 		one to reach the LSI domain (CMPOK, 2 LSI clocks at most). A target closer than SAMPLER_MIN_LEAD
+ * 		may be passed before the write lands, the interrupt is pended instead of waiting for a wrap
+ * 		Call with interrupts masked or from the LPTIM1 interrupt
+ * @param  None
+ * @retval None
+ */
+static void load_Compare(void)
+{
+    uint64_t target = ((wakeup_stamp != 0) && (wakeup_stamp < next_trigger)) ? wakeup_stamp : next_trigger;
+
+    if ((uint16_t)target != loaded_compare)
+    {
+        while ((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0)
+        {
+        }
+        LPTIM1->ICR = LPTIM_ICR_CMPOKCF;
+        LPTIM1->CMP = (uint16_t)target;
+        loaded_compare = (uint16_t)target;
+    }
+    if (target <= read_Timestamp() + SAMPLER_MIN_LEAD)
+    {
+        NVIC_SetPendingIRQ(LPTIM1_IRQn);
+    }
+}
+
+/**
+ * @brief  LPTIM1 Interrupt Function
+ * @note   Called from LPTIM1_IRQHandler(). CMP matches once per counter wrap, only the match that reaches
+ * 		the 64 bit target is acted on, earlier wraps of a long period are ignored. The wake-up of
+ * 		set_Wakeup() may be taken up to SAMPLER_MIN_LEAD ticks early, the grid instant never is
+ * @param  None
+ * @retval None
+ */
+extern "C" void Sampler_LPTIM_IRQHandler(void)
+{
+
+    uint32_t isr = LPTIM1->ISR;
+    uint8_t triggered = 0;
+    uint64_t now;
+
+    if (isr & LPTIM_ISR_ARRM)
+    {
+        LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+        overflows = overflows + 1;
+    }
+    if (isr & LPTIM_ISR_CMPM)
+    {
+        LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+    }
+    if ((LPTIM1->CR & LPTIM_CR_ENABLE) == 0)
+    {
+        return;                                     /*  Pended after Stop()  */
+    }
+
+    now = read_Timestamp();
+    if ((wakeup_stamp != 0) && (now + SAMPLER_MIN_LEAD >= wakeup_stamp))
+    {
+        wakeup_stamp = 0;
+        wakeup_hit = 1;
+    }
+
+    if (now >= next_trigger)
+    {
+        if (pending)
+        {
+            overrun_count = overrun_count + 1;
+        }
+        trigger_stamp = next_trigger;
+        pending = 1;
+        triggered = 1;
+
+        next_trigger += period_ticks;
+        while (next_trigger <= now)                 /*  Stalled longer than a period (debugger)  */
+        {
+            next_trigger += period_ticks;
+            overrun_count = overrun_count + 1;
+        }
+    }
+    load_Compare();
+
+    if (triggered && (notify_hook != NULL))
+    {
+        notify_hook();
+    }
+
+}
+
+/**
+ * @brief  Sampler Initialization Function
+ * @note   Starts LSI, runs LPTIM1 free from it and arms the first instant one period after the start.
+ * 		EXTI line 32 is routed so the trigger and the LowPower_c deadline wake the core from STOP2
+ * @param  uint32_t period_ms	:	Sampling period (ms)
+ * @retval None
+ */
+void Sampler_c::Init(uint32_t period_ms)
+{
+
+    __HAL_RCC_LSI_ENABLE();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY) == 0)
+    {
+    }
+
+    MODIFY_REG(RCC->CCIPR, RCC_CCIPR_LPTIM1SEL, RCC_CCIPR_LPTIM1SEL_0);
+    __HAL_RCC_LPTIM1_CLK_ENABLE();
+    __HAL_RCC_LPTIM1_CLK_SLEEP_ENABLE();
+
+    overflows = 0;
+    pending = 0;
+    overrun_count = 0;
+    wakeup_stamp = 0;
+    wakeup_hit = 0;
+    latency_valid = 0;
+    stats = {};
+    period_ticks = (period_ms == 0) ? 1 : period_ms * (SAMPLER_TICK_HZ / 1000U);
+    next_trigger = period_ticks;
+
+    LPTIM1->CR = 0;
+    LPTIM1->CFGR = 0;                           /*  Internal clock, no prescaler               */
+    LPTIM1->IER = LPTIM_IER_ARRMIE | LPTIM_IER_CMPMIE;
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+    LPTIM1->ARR = 0xFFFF;
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0)
+    {
+    }
+    LPTIM1->CMP = (uint16_t)next_trigger;
+    loaded_compare = (uint16_t)next_trigger;
+    while ((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0)
+    {
+    }
+
+    EXTI->IMR2 |= EXTI_IMR2_IM32;
+    HAL_NVIC_SetPriority(LPTIM1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+    LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+
+}
+
+/**
+ * @brief  Stop Sampling Clock
+ * @note   The timebase stops as well, so do the LowPower_c deadlines : sleep() then only wakes on EXTI
+ * @param  None
+ * @retval None
+ */
+void Sampler_c::Stop()
+{
+
+    HAL_NVIC_DisableIRQ(LPTIM1_IRQn);
+    EXTI->IMR2 &= ~EXTI_IMR2_IM32;
+    LPTIM1->CR = 0;
+    pending = 0;
+    wakeup_stamp = 0;
+
+}
+
+/**
+ * @brief  Set Trigger Notification
+ * @note   Called from the LPTIM1 interrupt on every sampling instant, e.g. to post a Scheduler_c event
+ * @param  void (*notify)(void)	:	NULL = poll only
+ * @retval None
+ */
+void Sampler_c::set_Notify(void (*notify)(void))
+{
+
+    notify_hook = notify;
+
+}
+
+/**
+ * @brief  Set Wake-up
+ * @note   One-shot, shares the compare with the sampling grid so the deadline of LowPower_c runs on the
+ * 		timer that keeps counting in STOP2. A new call replaces a pending wake-up. Ignored while
+ * 		stopped. Safe with interrupts masked (Scheduler_c idle hook)
+ * @param  uint32_t ms	:	From now (1.. ms)
+ * @retval None
+ */
+void Sampler_c::set_Wakeup(uint32_t ms)
+{
+
+    uint32_t primask = __get_PRIMASK();
+
+    if ((LPTIM1->CR & LPTIM_CR_ENABLE) == 0)
+    {
+        return;
+    }
+
+    __disable_irq();
+    wakeup_stamp = read_Timestamp() + (uint64_t)((ms == 0) ? 1 : ms) * (SAMPLER_TICK_HZ / 1000U);
+    wakeup_hit = 0;
+    load_Compare();
+    __set_PRIMASK(primask);
+
+}
+
+/**
+ * @brief  Take Wake-up
+ * @note   Reports a wake-up instant reached since set_Wakeup(), also when the caller still masks the
+ * 		interrupt that would record it
+ * @param  None
+ * @retval uint8_t	:	1 = reached, 0 = pending or none
+ */
+uint8_t Sampler_c::take_Wakeup()
+{
+
+    uint32_t primask = __get_PRIMASK();
+    uint8_t hit;
+
+    __disable_irq();
+    if ((wakeup_stamp != 0) && (read_Timestamp() >= wakeup_stamp))
+    {
+        wakeup_stamp = 0;
+        wakeup_hit = 1;
+    }
+    hit = wakeup_hit;
+    wakeup_hit = 0;
+    __set_PRIMASK(primask);
+
+    return hit;
+
+}
+
+/**
+ * @brief  Get Current Timestamp
+ * @note   Monotonic, SAMPLER_TICK_HZ ticks since Init()
+ * @param  None
+ * @retval uint64_t
+ */
+uint64_t Sampler_c::get_Timestamp()
+{
+
+    return read_Timestamp();
+
+}
+
+/**
+ * @brief  Poll Sampling Instant
+ * @note   Returns 1 once per instant, start the conversion right after and call mark_Triggered()
+ * @param  uint64_t *timestamp	:	Grid instant of the trigger
+ * @retval uint8_t			:	1 = trigger now, 0 = nothing pending
+ */
+uint8_t Sampler_c::poll_Trigger(uint64_t *timestamp)
+{
+
+    if (!pending)
+    {
+        return 0;
+    }
+
+    __disable_irq();
+    taken_stamp = trigger_stamp;
+    pending = 0;
+    __enable_irq();
+    *timestamp = taken_stamp;
+
+    return 1;
+
+}
+
+/**
+ * @brief  Mark Conversion Started
+ * @note   Latency is grid instant to now, jitter is the latency change between two consecutive samples,
+ * 		i.e. the deviation of the trigger period seen by the sensor
+ * @param  None
+ * @retval None
+ */
+void Sampler_c::mark_Triggered()
+{
+
+    uint32_t latency = (uint32_t)(read_Timestamp() - taken_stamp);
+    int32_t jitter = (int32_t)(latency - stats.last_latency);
+    uint32_t magnitude = (jitter < 0) ? (uint32_t)(-jitter) : (uint32_t)jitter;
+
+    if (latency_valid)
+    {
+        stats.last_jitter = jitter;
+        if (magnitude > stats.worst_jitter)
+        {
+            stats.worst_jitter = magnitude;
+        }
+        if (magnitude > 1)
+        {
+            stats.jitter_events++;
+        }
+    }
+    latency_valid = 1;
+
+    stats.last_latency = latency;
+    if (latency > stats.worst_latency)
+    {
+        stats.worst_latency = latency;
+    }
+    stats.triggers++;
+
+}
+
+/**
+ * @brief  Ticks to Microseconds
+ * @note   None
+ * @param  uint64_t ticks
+ * @retval uint64_t
+ */
+uint64_t Sampler_c::to_Microseconds(uint64_t ticks)
+{
+
+    return (ticks * 1000000U) / SAMPLER_TICK_HZ;
+
+}
+
+/**
+ * @brief  Get Jitter Statistics
+ * @note   One tick is 31.25 us, latency below one tick reads as 0
+ * @param  None
+ * @retval const jitter_stats_t &
+ */
+const Sampler_c::jitter_stats_t &Sampler_c::get_Statistics()
+{
+
+    stats.overruns = overrun_count;
+    return stats;
+
+}
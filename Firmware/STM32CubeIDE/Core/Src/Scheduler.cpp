@@ -0,0 +1,312 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Cooperative run-to-completion scheduler : ISR-posted events, timers, priorities
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <Scheduler.hpp>
+#include <Trace.hpp>
+#include <Placement.h>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <Scheduler.hpp>
+ *	Scheduler_c Scheduler;
+ *	uint8_t ev_drdy;
+ *	void task_Drdy(void) { temperature=HDC2022.get_Temperature(); }
+ *	void HAL_GPIO_EXTI_Callback(uint16_t pin) { Scheduler.post(ev_drdy); }
+ * 	void main()
+ * 	{
+ * 	 Scheduler.Init(HAL_GetTick, NULL);
+ * 	 ev_drdy = Scheduler.add_Event(task_Drdy, 0);
+ * 	 Scheduler.start_Timer(Scheduler.add_Timer(ev_drdy, 1000, 1), 1000);
+ * 	 Scheduler.run();
+ * 	}
+ */
+
+/**
+ * @brief  Scheduler Initialization Function
+ * @note   now_ms must keep counting while the idle hook sleeps, HAL_GetTick() does not advance in STOP modes
+ * @param  clock_fn_t now_ms	:	Millisecond clock
+ * @param  idle_fn_t idle		:	Called with interrupts masked when nothing is pending, NULL = busy wait
+ * @retval None
+ */
+void Scheduler_c::Init(clock_fn_t now_ms, idle_fn_t idle)
+{
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    this->now_ms = now_ms;
+    this->idle = idle;
+
+}
+
+/**
+ * @brief  Register Event
+ * @note   Call before run()
+ * @param  handler_t handler	:	Run-to-completion handler
+ * @param  uint8_t priority	:	0 (highest) .. SCHED_PRIORITIES - 1
+ * @retval uint8_t			:	Event id, SCHED_NO_ID when out of slots
+ */
+uint8_t Scheduler_c::add_Event(handler_t handler, uint8_t priority)
+{
+
+    if ((event_count >= SCHED_MAX_EVENTS) || (handler == NULL))
+    {
+        return SCHED_NO_ID;
+    }
+
+    events[event_count].handler = handler;
+    events[event_count].priority = (priority < SCHED_PRIORITIES) ? priority : SCHED_PRIORITIES - 1;
+    events[event_count].stamp = 0;
+
+    return event_count++;
+
+}
+
+/**
+ * @brief  Post Event
+ * @note   Interrupt safe, a post to an already pending event is merged and keeps the first stamp
+ * @param  uint8_t event	:	Event id
+ * @retval None
+ */
+RAM2_FUNC void Scheduler_c::post(uint8_t event)
+{
+
+    uint32_t primask;
+    uint32_t bit;
+    uint8_t priority;
+
+    if (event >= event_count)
+    {
+        return;
+    }
+
+    bit = 1UL << event;
+    priority = events[event].priority;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if ((pending[priority] & bit) == 0)
+    {
+        events[event].stamp = DWT->CYCCNT;
+        pending[priority] |= bit;
+    }
+    stats[event].posts++;
+    __set_PRIMASK(primask);
+    TRACE(TRACE_SCHED_POST, event);
+
+}
+
+/**
+ * @brief  Register Timer
+ * @note   The timer is stopped until start_Timer()
+ * @param  uint8_t event		:	Event posted on expiry
+ * @param  uint32_t period_ms	:	Reload period of a periodic timer
+ * @param  uint8_t periodic	:	0 = one-shot, 1 = periodic
+ * @retval uint8_t			:	Timer id, SCHED_NO_ID when out of slots
+ */
+uint8_t Scheduler_c::add_Timer(uint8_t event, uint32_t period_ms, uint8_t periodic)
+{
+
+    if (timer_count >= SCHED_MAX_TIMERS)
+    {
+        return SCHED_NO_ID;
+    }
+
+    timers[timer_count].event = event;
+    timers[timer_count].period = period_ms;
+    timers[timer_count].periodic = periodic;
+    timers[timer_count].active = 0;
+
+    return timer_count++;
+
+}
+
+/**
+ * @brief  Start Timer
+ * @note   Restarts a running timer. Thread context only
+ * @param  uint8_t timer		:	Timer id
+ * @param  uint32_t delay_ms	:	First expiry from now
+ * @retval None
+ */
+void Scheduler_c::start_Timer(uint8_t timer, uint32_t delay_ms)
+{
+
+    if (timer >= timer_count)
+    {
+        return;
+    }
+
+    timers[timer].due = now_ms() + delay_ms;
+    timers[timer].active = 1;
+
+}
+
+/**
+ * @brief  Stop Timer
+ * @note   Thread context only
+ * @param  uint8_t timer	:	Timer id
+ * @retval None
+ */
+void Scheduler_c::stop_Timer(uint8_t timer)
+{
+
+    if (timer < timer_count)
+    {
+        timers[timer].active = 0;
+    }
+
+}
+
+/**
+ * @brief  Poll Timers
+ * @note   Posts the expired ones, a periodic timer that fell behind is re-based on now instead of bursting
+ * @param  None
+ * @retval uint32_t	:	ms to the next expiry, SCHED_FOREVER when no timer runs
+ */
+uint32_t Scheduler_c::poll_Timers()
+{
+
+    uint32_t now = now_ms();
+    uint32_t next = SCHED_FOREVER;
+
+    for (uint8_t i = 0; i < timer_count; i++)
+    {
+        sched_timer_t *t = &timers[i];
+
+        if (!t->active)
+        {
+            continue;
+        }
+
+        if ((int32_t)(now - t->due) >= 0)
+        {
+            post(t->event);
+            if (!t->periodic)
+            {
+                t->active = 0;
+                continue;
+            }
+            t->due += t->period;
+            if ((int32_t)(now - t->due) >= 0)
+            {
+                t->due = now + t->period;
+            }
+        }
+
+        if ((t->due - now) < next)
+        {
+            next = t->due - now;
+        }
+    }
+
+    return next;
+
+}
+
+/**
+ * @brief  Dispatch One Event
+ * @note   Timers are polled first, then the highest priority pending handler runs. The latency is
+ * 		converted to us with the clock that runs now
+ * @param  None
+ * @retval uint8_t	:	1 = a handler ran, 0 = nothing pending
+ */
+uint8_t Scheduler_c::run_Once()
+{
+
+    uint8_t event = SCHED_NO_ID;
+    uint32_t primask;
+
+    poll_Timers();
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (uint8_t p = 0; p < SCHED_PRIORITIES; p++)
+    {
+        if (pending[p])
+        {
+            event = (uint8_t)__builtin_ctz(pending[p]);
+            pending[p] &= ~(1UL << event);
+            break;
+        }
+    }
+    __set_PRIMASK(primask);
+
+    if (event == SCHED_NO_ID)
+    {
+        return 0;
+    }
+
+    stats[event].last_latency = (DWT->CYCCNT - events[event].stamp) / (SystemCoreClock / 1000000U);
+    if (stats[event].last_latency > stats[event].worst_latency)
+    {
+        stats[event].worst_latency = stats[event].last_latency;
+    }
+    stats[event].dispatches++;
+
+    TRACE(TRACE_SCHED_RUN, event);
+    events[event].handler();
+
+    return 1;
+
+}
+
+/**
+ * @brief  Run Scheduler
+ * @note   Never returns. The idle hook runs with interrupts masked and is skipped when an event
+ * 		was posted meanwhile, pending interrupts are served right after it returns
+ * @param  None
+ * @retval None
+ */
+void Scheduler_c::run()
+{
+
+    while (1)
+    {
+        uint32_t sleep_ms;
+        uint8_t busy = 0;
+
+        if (run_Once())
+        {
+            continue;
+        }
+
+        sleep_ms = poll_Timers();
+
+        __disable_irq();
+        for (uint8_t p = 0; p < SCHED_PRIORITIES; p++)
+        {
+            busy |= (pending[p] != 0);
+        }
+        if (!busy && (idle != NULL))
+        {
+            idle(sleep_ms);
+        }
+        __enable_irq();
+    }
+
+}
+
+/**
+ * @brief  Get Event Statistics
+ * @note   Latencies are in microseconds
+ * @param  uint8_t event	:	Event id
+ * @retval const event_stats_t &
+ */
+const Scheduler_c::event_stats_t &Scheduler_c::get_Statistics(uint8_t event)
+{
+
+    return stats[(event < SCHED_MAX_EVENTS) ? event : 0];
+
+}
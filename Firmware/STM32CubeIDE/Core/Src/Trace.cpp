@@ -0,0 +1,74 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        ITM/SWO event trace points with hardware timestamps
+ @
+ @   Version            :        1.0.0
+ */
+
+#include <Trace.hpp>
+
+/*
+ * Example Usage
+ *
+ *
+ * 	#include <Trace.hpp>
+ *	Trace_c Trace;
+ * 	void main()
+ * 	{
+ * 	 Trace.Init();
+ * 	 TRACE(TRACE_USER, 42);
+ * 	}
+ */
+
+#define TRACE_PORTS             0xFFFFFFFEUL    /*  Port 0 stays free for ITM_SendChar()  */
+
+/**
+ * @brief  Trace Initialization Function
+ * @note   Async SWO (NRZ) without formatter, ITM with local timestamps and sync packets.
+ * 		A debugger may configure the same registers again when it starts its own capture
+ * @param  None
+ * @retval None
+ */
+void Trace_c::Init()
+{
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DBGMCU->CR = (DBGMCU->CR & ~DBGMCU_CR_TRACE_MODE) | DBGMCU_CR_TRACE_IOEN;
+
+    TPI->SPPR = 2;                                      /*  NRZ  */
+    TPI->FFCR = 1UL << TPI_FFCR_TrigIn_Pos;             /*  Formatter bypassed  */
+
+    DWT->CTRL |= (1UL << DWT_CTRL_SYNCTAP_Pos) | DWT_CTRL_CYCCNTENA_Msk;
+
+    ITM->LAR = 0xC5ACCE55;
+    ITM->TCR = (1UL << ITM_TCR_TraceBusID_Pos) | ITM_TCR_SYNCENA_Msk | ITM_TCR_TSENA_Msk | ITM_TCR_ITMENA_Msk;
+    ITM->TPR = 0;
+    ITM->TER = TRACE_PORTS;
+    retime();
+
+}
+
+/**
+ * @brief  Retime SWO
+ * @note   The SWO prescaler runs from HCLK, call after every SYSCLK change. Emits TRACE_CLOCK
+ * @param  None
+ * @retval None
+ */
+void Trace_c::retime()
+{
+
+    uint32_t hclk = HAL_RCC_GetHCLKFreq();
+
+    while ((ITM->TCR & ITM_TCR_BUSY_Msk) != 0)
+    {
+    }
+    TPI->ACPR = (hclk / TRACE_SWO_BAUD) - 1;
+    TRACE(TRACE_CLOCK, hclk);
+
+}
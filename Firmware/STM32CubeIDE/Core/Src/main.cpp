@@ -23,6 +23,16 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <LowPower.hpp>
+#include <ClockGovernor.hpp>
+#include <Sampler.hpp>
+#include <RtcClock.hpp>
+#include <Scheduler.hpp>
+#include <I2CBus.hpp>
+#include <Log.hpp>
+#include <Trace.hpp>
+#include <HDC2022Async.hpp>
+#include <Deadband.hpp>
 
 /* USER CODE END Includes */
 
@@ -37,6 +47,8 @@
 
 /* Private macro -------------------------------------------------------------*/
 /* USER CODE BEGIN PM */
+/*  Milliseconds of an RtcClock_c stamp, logged next to its seconds as two 32 bit words  */
+#define WALL_MS(stamp)        ((uint32_t)(stamp).subseconds * 1000U / (RTC_PREDIV_S + 1))
 
 /* USER CODE END PM */
 
@@ -46,6 +58,7 @@ I2C_HandleTypeDef hi2c1;
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+volatile uint8_t hdc2022_alarm = 0;
 
 /* USER CODE END PV */
 
@@ -55,12 +68,55 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_I2C1_Init(void);
 /* USER CODE BEGIN PFP */
+static void HDC2022_INT_Init(void);
+static uint32_t clock_Ms(void);
+static void idle_Sleep(uint32_t sleep_ms);
+static void on_Trigger(void);
+static void task_Trigger(void);
+static void task_Sample(void);
+static void on_Transfer(void);
+static uint8_t acquire(void);
+#if RAM2_BENCH
+static void ram2_Benchmark(void);
+#endif
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 HDC2022_c HDC2022;
+LowPower_c LowPower;
+ClockGovernor_c Governor;
+Sampler_c Sampler;
+RtcClock_c Rtc;
+uint8_t rtc_ready = 0;
+Scheduler_c Scheduler RAM2_DATA;
+uint8_t ev_trigger, ev_sample;
+uint8_t tm_backstop;
+I2CBus_c I2CBus RAM2_DATA;
+Log_c Log;
+Trace_c Trace;
+HDC2022Async_c SensorAsync;
+Deadband_c Deadband;
+static async_t pt_acquire, pt_op;
+#if !PEAK_MONITOR
+static uint8_t status;
+#endif
+Sampler_c::sample_t sample;
+static HDC2022_c::result_t sensor_result;
+static uint32_t ready_us;             /* probe + ID check + configuration */
+static uint32_t ready_ms;             /* sensor ready, ms after HAL_Init() */
+#if PEAK_MONITOR
+static HDC2022_c::peak_sample_t peaks;
+static uint8_t peak_configuration[HDC2022_c::ConfigurationSize];
+static uint16_t peak_conversions;     /* conversions since the last read */
+static uint16_t peak_reads;           /* reads since the last reset of the maxima */
+static uint8_t peak_due;              /* 1 = next acquire() reads */
+static hdc_raw_sample_t peak_max;     /* maxima as 16 bit codes, what Deadband filters in peak mode */
+#endif
+#if RAM2_BENCH
+static uint32_t bench_cycles[4];      /* flash warm, SRAM2 warm, flash cold, SRAM2 cold */
+#endif
 /* USER CODE END 0 */
 
 /**
@@ -94,9 +150,58 @@ int main(void)
   MX_USART2_UART_Init();
   MX_I2C1_Init();
   /* USER CODE BEGIN 2 */
-  HDC2022.Init(hi2c1,100);
-  HDC2022.TEMPERATURE_OFFSET_ADJUSTMENT.bits.bit0=1;
-  HDC2022.set_TemperatureOffset();
+  Trace.Init();
+#if RAM2_BENCH
+  ram2_Benchmark();
+#endif
+  HDC2022.set_RecoveryPins(GPIOB, GPIO_PIN_6, GPIOB, GPIO_PIN_7);
+  HDC2022.set_Retry(2);
+  ready_us = DWT->CYCCNT;
+  sensor_result = HDC2022.Init(hi2c1,10);
+  ready_us = (DWT->CYCCNT - ready_us) / (SystemCoreClock / 1000000U);
+  ready_ms = HAL_GetTick();
+  if (sensor_result == HDC2022_c::RESULT_OK)
+  {
+    /* No sensor : nothing is written, no DRDY interrupt, the sampler runs as the timebase only */
+    HDC2022.TEMPERATURE_OFFSET_ADJUSTMENT.bits.bit0=1;
+    HDC2022.set_TemperatureOffset();
+    HDC2022.INTERRUPT_ENABLE.bits.DRDY_ENABLE = (PEAK_MONITOR == 0);  /* peak mode : pin only for threshold crossings */
+    HDC2022.set_TemperatureAlarm(10.0f, 35.0f);
+    HDC2022.set_HumidityAlarm(20.0f, 80.0f);
+    HDC2022_INT_Init();
+    HDC2022.arm_Alarm(HDC2022_c::RATE_ONE_SHOT, 1, 0);
+  }
+  LowPower.Init(&Sampler);
+  Governor.attach_I2C(&hi2c1);
+  Governor.Init();
+  Governor.set_Mode(ClockGovernor_c::CLOCK_LOW);
+  Log.Init(&huart2);
+  Deadband.Init(DEADBAND_TEMPERATURE, DEADBAND_HUMIDITY, DEADBAND_HEARTBEAT_MS);
+  LOG_TOKEN("HDC2022 0x%02x result %u : ready in %lu us, %lu ms after reset\n", HDC2022.get_Address() >> 1,
+            sensor_result, ready_us, ready_ms);
+#if RAM2_BENCH
+  LOG_TOKEN("ram2 bench flash %lu/%lu SRAM2 %lu/%lu cycles (warm/cold)\n",
+            bench_cycles[0], bench_cycles[2], bench_cycles[1], bench_cycles[3]);
+#endif
+  rtc_ready = Rtc.Init(RtcClock_c::parse_BuildTime(__DATE__, __TIME__) - RTC_BUILD_UTC_OFFSET);
+  Sampler.Init(1000);
+  if (sensor_result == HDC2022_c::RESULT_OK)
+  {
+    Sampler.set_Notify(on_Trigger);
+  }
+
+  Scheduler.Init(clock_Ms, idle_Sleep);
+  ev_sample = Scheduler.add_Event(task_Sample, 0);
+  ev_trigger = Scheduler.add_Event(task_Trigger, 1);
+  tm_backstop = Scheduler.add_Timer(ev_sample, 0, 0);
+  I2CBus.Init(HDC2022.get_Handle(), clock_Ms);
+  Governor.attach_Bus(&I2CBus);
+  if (sensor_result == HDC2022_c::RESULT_OK)
+  {
+    HDC2022.attach_Bus(&I2CBus, 1);
+    SensorAsync.bind_Bus(&I2CBus, HDC2022.get_Address(), 0);
+    SensorAsync.set_Notify(on_Transfer);
+  }
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -106,9 +211,7 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-	  HDC2022.get_Temperature();
-
-
+	  Scheduler.run();
   }
   /* USER CODE END 3 */
 }
@@ -154,7 +257,7 @@ void SystemClock_Config(void)
     Error_Handler();
   }
   PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART2|RCC_PERIPHCLK_I2C1;
-  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_PCLK1;
+  PeriphClkInit.Usart2ClockSelection = RCC_USART2CLKSOURCE_HSI;
   PeriphClkInit.I2c1ClockSelection = RCC_I2C1CLKSOURCE_PCLK1;
   if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
   {
@@ -280,9 +383,258 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(LD2_GPIO_Port, &GPIO_InitStruct);
 
+  /*Configure GPIO pin : HDC_INT_Pin */
+  GPIO_InitStruct.Pin = HDC_INT_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+  HAL_GPIO_Init(HDC_INT_GPIO_Port, &GPIO_InitStruct);
+
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief HDC2022 DRDY/INT pin Interrupt Enable Function
+  * @note  Pin is driven active high by HDC2022_c::arm_Alarm(), rising edge wakes the core from STOP2.
+  *        PA8 (GPXTI8) is configured by MX_GPIO_Init() from the .ioc, its NVIC line stays disabled there
+  *        because EXTI9_5_IRQHandler runs from SRAM2 (stm32l4xx_it.c, USER CODE 1)
+  * @param None
+  * @retval None
+  */
+static void HDC2022_INT_Init(void)
+{
+  HAL_NVIC_SetPriority(HDC_INT_EXTI_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(HDC_INT_EXTI_IRQn);
+}
+
+/**
+  * @brief  EXTI line detection callback
+  * @param  GPIO_Pin: Specifies the pins connected EXTI line
+  * @retval None
+  */
+RAM2_FUNC void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == HDC_INT_Pin)
+  {
+    TRACE(TRACE_DRDY, GPIO_Pin);
+    hdc2022_alarm = 1;
+    Scheduler.post(ev_sample);
+  }
+}
+
+/**
+  * @brief Scheduler clock, keeps counting in STOP modes (Sampler_c LPTIM1 timebase)
+  * @retval uint32_t ms
+  */
+static uint32_t clock_Ms(void)
+{
+  return (uint32_t)(Sampler.get_Timestamp() / (SAMPLER_TICK_HZ / 1000U));
+}
+
+/**
+  * @brief Scheduler idle hook, sleeps until the next timer or any wake-up interrupt
+  * @param sleep_ms: Time to the next scheduler timer
+  * @retval None
+  */
+static void idle_Sleep(uint32_t sleep_ms)
+{
+  if (sleep_ms < 2)
+  {
+    return;
+  }
+  if ((Log.get_Pending() != 0) || I2CBus.is_Busy())
+  {
+    __WFI();                              /*  Sleep mode, the log DMA and I2C1 (PCLK1) stop in STOP  */
+    return;
+  }
+  LowPower.set_Deadline((sleep_ms > 0xFFFF) ? 0xFFFF : (uint16_t)sleep_ms);
+  LowPower.sleep();
+}
+
+/**
+  * @brief Sampler_c trigger notification, LPTIM1 interrupt context
+  * @retval None
+  */
+static void on_Trigger(void)
+{
+  Scheduler.post(ev_trigger);
+}
+
+/**
+  * @brief Sampling instant : the conversion starts on the LPTIM1 grid, not on the loop speed
+  * @retval None
+  */
+static void task_Trigger(void)
+{
+  if (Sampler.poll_Trigger(&sample.timestamp))
+  {
+    HDC2022.trigger_Measurement();
+    Sampler.mark_Triggered();
+    if (rtc_ready)
+    {
+      sample.wall = Rtc.get_Timestamp();
+    }
+#if PEAK_MONITOR
+    /*  The maxima follow every conversion on the device, the MCU only reads every PEAK_MONITOR-th  */
+    if (++peak_conversions >= PEAK_MONITOR)
+    {
+      peak_conversions = 0;
+      peak_due = 1;
+      Scheduler.start_Timer(tm_backstop, 10);   /* conversion done, DRDY is not routed to the pin */
+    }
+#else
+    Scheduler.start_Timer(tm_backstop, 1500);
+#endif
+  }
+}
+
+/**
+  * @brief DRDY edge, backstop timer or transfer completion : resumes the acquisition
+  * @retval None
+  */
+static void task_Sample(void)
+{
+  Scheduler.stop_Timer(tm_backstop);
+#if PEAK_MONITOR
+  if (hdc2022_alarm)
+  {
+    peak_due = 1;                         /*  Threshold crossing, read now  */
+  }
+#endif
+  hdc2022_alarm = 0;
+  acquire();
+}
+
+/**
+  * @brief HDC2022Async_c completion notification, I2C1 interrupt context
+  * @retval None
+  */
+static void on_Transfer(void)
+{
+  Scheduler.post(ev_sample);
+}
+
+/**
+  * @brief Acquisition sequence : STATUS read also releases the latched pin, then one burst for both codes,
+  *        logged through the Deadband_c report filter.
+  *        Peak mode : one burst for the codes, STATUS and the maxima, and every PEAK_RESET_READS reads a
+  *        restart of the sensor, the only way to clear the maxima
+  * @retval uint8_t ASYNC_RUNNING, ASYNC_DONE or ASYNC_ERROR
+  */
+static uint8_t acquire(void)
+{
+  ASYNC_BEGIN(&pt_acquire);
+
+#if PEAK_MONITOR
+  if (!peak_due)
+  {
+    ASYNC_EXIT(&pt_acquire, ASYNC_DONE);
+  }
+  peak_due = 0;
+  ASYNC_CALL(&pt_acquire, &pt_op, SensorAsync.read_Peaks(&pt_op, &peaks));
+  sample.raw = peaks.last;
+  TRACE(TRACE_SAMPLE, ((uint32_t)sample.raw.humidity << 16) | sample.raw.temperature);
+  LowPower.mark_Sample();
+  /*  8 bit maxima go out as the high byte of a code, LogDecoder expands them like the samples.
+      Logged when the maxima moved, the heartbeat still carries the last sample  */
+  peak_max.temperature = (uint16_t)(peaks.temperature_max << 8);
+  peak_max.humidity = (uint16_t)(peaks.humidity_max << 8);
+  if (Deadband.update(peak_max, clock_Ms()))
+  {
+    LOG_TOKEN("%lu.%03lu T=%T RH=%H max T=%T RH=%H skipped %lu\n", sample.wall.seconds, WALL_MS(sample.wall),
+              sample.raw.temperature, sample.raw.humidity, peak_max.temperature, peak_max.humidity, Deadband.get_Suppressed());
+  }
+  if (HDC2022.get_PeakAlarm(peaks))
+  {
+    LOG_TOKEN("%lu.%03lu peak alarm 0x%02x\n", sample.wall.seconds, WALL_MS(sample.wall), HDC2022.get_PeakAlarm(peaks));
+  }
+  if (++peak_reads >= PEAK_RESET_READS)
+  {
+    peak_reads = 0;
+    HDC2022.get_Configuration(peak_configuration);
+    ASYNC_CALL(&pt_acquire, &pt_op, SensorAsync.restart(&pt_op, peak_configuration));
+  }
+#else
+  ASYNC_CALL(&pt_acquire, &pt_op, SensorAsync.read_Status(&pt_op, &status));
+  if (HDC2022Map::STATUS::DRDY_STATUS::get(status))
+  {
+    ASYNC_CALL(&pt_acquire, &pt_op, SensorAsync.read_Sample(&pt_op, &sample.raw));
+    TRACE(TRACE_SAMPLE, ((uint32_t)sample.raw.humidity << 16) | sample.raw.temperature);
+    LowPower.mark_Sample();
+    /*  Codes go out as is, LogDecoder expands %T / %H to °C / %RH. Only changes and the heartbeat are
+        logged, skipped rebuilds the sample count  */
+    if (Deadband.update(sample.raw, clock_Ms()))
+    {
+      LOG_TOKEN("%lu.%03lu T=%T RH=%H skipped %lu\n", sample.wall.seconds, WALL_MS(sample.wall), sample.raw.temperature,
+                sample.raw.humidity, Deadband.get_Suppressed());
+    }
+  }
+#endif
+
+  ASYNC_END(&pt_acquire);
+}
+
+#if RAM2_BENCH
+/*
+ * Same kernel twice, once in flash and once in SRAM2 : 64 temperature conversions
+ * with a data dependent branch, close to the DRDY -> sample path.
+ */
+#define BENCH_KERNEL(name, placement)                                 \
+  placement static float name(const uint16_t *codes, uint32_t count)  \
+  {                                                                   \
+    float sum = 0.0f;                                                 \
+    for (uint32_t i = 0; i < count; i++)                              \
+    {                                                                 \
+      float t = codes[i] * (165.0f / 65536.0f) - 40.0f;               \
+      sum += (t > 25.0f) ? (t - 25.0f) : (25.0f - t);                 \
+    }                                                                 \
+    return sum;                                                       \
+  }
+
+BENCH_KERNEL(kernel_Flash, )
+BENCH_KERNEL(kernel_Ram2, RAM2_FUNC)
+
+/**
+  * @brief Time one kernel run with DWT, cold = ART instruction cache flushed first
+  * @retval uint32_t cycles
+  */
+static uint32_t bench_Run(float (*kernel)(const uint16_t *, uint32_t), const uint16_t *codes, uint8_t cold)
+{
+  volatile float sink;
+  uint32_t start;
+
+  if (cold)
+  {
+    __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+    __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+    __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+  }
+  start = DWT->CYCCNT;
+  sink = kernel(codes, 64);
+  (void)sink;
+
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief Flash (FLASH_LATENCY_4 + ART) against SRAM2 at 80 MHz, before the clock governor lowers SYSCLK
+  * @retval None
+  */
+static void ram2_Benchmark(void)
+{
+  uint16_t codes[64];
+
+  for (uint16_t i = 0; i < 64; i++)
+  {
+    codes[i] = (uint16_t)(i * 1021U);
+  }
+  bench_Run(kernel_Flash, codes, 0);
+  bench_Run(kernel_Ram2, codes, 0);
+  bench_cycles[0] = bench_Run(kernel_Flash, codes, 0);
+  bench_cycles[1] = bench_Run(kernel_Ram2, codes, 0);
+  bench_cycles[2] = bench_Run(kernel_Flash, codes, 1);
+  bench_cycles[3] = bench_Run(kernel_Ram2, codes, 1);
+}
+#endif
 
 /* USER CODE END 4 */
 
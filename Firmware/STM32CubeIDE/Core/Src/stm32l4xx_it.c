@@ -58,6 +58,11 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
+extern void Sampler_LPTIM_IRQHandler(void);
+extern void I2CBus_EV_IRQHandler(void);
+extern void I2CBus_ER_IRQHandler(void);
+extern void Log_DMA_IRQHandler(void);
+extern void Log_UART_IRQHandler(void);
 
 /* USER CODE END EV */
 
@@ -199,5 +204,53 @@ void SysTick_Handler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles EXTI line[9:5] interrupts (HDC2022 DRDY/INT pin).
+  */
+RAM2_FUNC void EXTI9_5_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(HDC_INT_Pin);
+}
+
+/**
+  * @brief This function handles LPTIM1 global interrupt (sampling clock timebase, trigger and wake-up deadline).
+  */
+void LPTIM1_IRQHandler(void)
+{
+  Sampler_LPTIM_IRQHandler();
+}
+
+/**
+  * @brief This function handles I2C1 event interrupt (I2CBus_c transaction queue).
+  */
+RAM2_FUNC void I2C1_EV_IRQHandler(void)
+{
+  I2CBus_EV_IRQHandler();
+}
+
+/**
+  * @brief This function handles I2C1 error interrupt (I2CBus_c transaction queue).
+  */
+RAM2_FUNC void I2C1_ER_IRQHandler(void)
+{
+  I2CBus_ER_IRQHandler();
+}
+
+/**
+  * @brief This function handles DMA1 channel7 global interrupt (log output, USART2 TX).
+  */
+RAM2_FUNC void DMA1_Channel7_IRQHandler(void)
+{
+  Log_DMA_IRQHandler();
+}
+
+/**
+  * @brief This function handles USART2 global interrupt (log output).
+  */
+void USART2_IRQHandler(void)
+{
+  Log_UART_IRQHandler();
+}
+
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
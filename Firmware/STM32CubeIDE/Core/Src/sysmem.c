@@ -24,12 +24,43 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include "main.h"
 
 /**
  * Pointer to the current high watermark of the heap usage
  */
 static uint8_t *__sbrk_heap_end = NULL;
 
+#if SYSMEM_HEAP_TRAP
+
+/**
+ * Return address of the first _sbrk() call. newlib calls _sbrk() through
+ * _sbrk_r(), so this points into _sbrk_r : the allocating code (malloc, new,
+ * newlib stdio buffers) is found in the debugger backtrace at the breakpoint
+ */
+volatile uint32_t sbrk_trap_caller = 0;
+
+/**
+ * @brief _sbrk() trap of the heap-free build (SYSMEM_HEAP_TRAP in main.h)
+ *
+ * Any heap use is a bug there : the return address is recorded, a breakpoint stops an
+ * attached debugger and without one the BKPT escalates to HardFault.
+ *
+ * @param incr Memory size
+ * @return Never returns
+ */
+void *_sbrk(ptrdiff_t incr)
+{
+  (void)incr;
+  sbrk_trap_caller = (uint32_t)__builtin_return_address(0);
+  __BKPT(0);
+  while (1)
+  {
+  }
+}
+
+#else
+
 /**
  * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
  *        and others from the C library
@@ -78,3 +109,5 @@ void *_sbrk(ptrdiff_t incr)
 
   return (void *)prev_heap_end;
 }
+
+#endif
@@ -81,6 +81,21 @@ LoopCopyDataInit:
 	adds	r2, r0, r1
 	cmp	r2, r3
 	bcc	CopyDataInit
+
+/* Copy the SRAM2 code and data from flash */
+	ldr	r0, =_sram2
+	ldr	r1, =_eram2
+	ldr	r2, =_siram2
+	b	LoopCopyRam2
+
+CopyRam2:
+	ldr	r3, [r2], #4
+	str	r3, [r0], #4
+
+LoopCopyRam2:
+	cmp	r0, r1
+	bcc	CopyRam2
+
 	ldr	r2, =_sbss
 	b	LoopFillZerobss
 /* Zero fill the bss segment. */
@@ -93,6 +108,18 @@ LoopFillZerobss:
 	cmp	r2, r3
 	bcc	FillZerobss
 
+/* Zero fill the SRAM2 bss segment. */
+	ldr	r2, =_sram2_bss
+	b	LoopFillZeroram2
+FillZeroram2:
+	movs	r3, #0
+	str	r3, [r2], #4
+
+LoopFillZeroram2:
+	ldr	r3, =_eram2_bss
+	cmp	r2, r3
+	bcc	FillZeroram2
+
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/
@@ -0,0 +1,210 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Replay of a sample stream through Deadband_c, log bytes per hour
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -I../../STM32CubeIDE/Core/Inc DeadbandReplay.cpp ../../STM32CubeIDE/Core/Src/Deadband.cpp -lm -o DeadbandReplay
+ *
+ * Usage
+ *
+ *	./DeadbandReplay [hours]                  synthetic office profile, 8 hours by default
+ *	./DeadbandReplay samples.csv              capture decoded by SampleDecoder (timestamp in ms, codes)
+ *
+ * The synthetic profile is sampled at 1 Hz like the firmware (Sampler.Init(1000)) : a slow warm-up, an
+ * HVAC cycle of +-0.4 °C every 15 minutes, a humidity burst after 3 hours and sensor noise of 0.01 °C /
+ * 0.03 %RH rms, quantized to codes. The filter runs with the firmware defaults of main.h (0.1 °C, 0.5 %RH,
+ * 60 s heartbeat). A logged sample is one LOG_TOKEN record of acquire() : mark, count, 32 bit token and
+ * 4 byte words for the wall seconds, milliseconds, T, RH and skipped (26 bytes), without the filter every
+ * sample is one record without skipped (22 bytes).
+ *
+ * Checked : every suppressed sample is within the deadband of the last logged one, the skipped counts of
+ * the logged records add up to the sample count and no gap between records exceeds the heartbeat.
+ * Exit code is 0 when every check passed.
+ */
+
+#include <Deadband.hpp>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REPLAY_PERIOD_MS      1000
+#define REPLAY_TEMPERATURE    0.1f    /*  main.h DEADBAND_TEMPERATURE                              */
+#define REPLAY_HUMIDITY       0.5f    /*  main.h DEADBAND_HUMIDITY                                 */
+#define REPLAY_HEARTBEAT_MS   60000   /*  main.h DEADBAND_HEARTBEAT_MS                             */
+#define RECORD_FILTERED       26      /*  2 + token + 5 words                                      */
+#define RECORD_PLAIN          22      /*  2 + token + 4 words                                      */
+
+typedef struct
+{
+    uint32_t timestamp;
+    hdc_raw_sample_t raw;
+} replay_sample_t;
+
+static replay_sample_t *samples;
+static uint32_t count;
+
+static uint16_t to_Code(double value, double scale, double offset)
+{
+    double code = (value + offset) * scale + 0.5;
+
+    return (uint16_t)((code < 0.0) ? 0.0 : ((code > 65535.0) ? 65535.0 : code));
+}
+
+/*  Box-Muller on a fixed LCG, the profile is the same on every run  */
+static double noise(uint32_t *seed)
+{
+    double u1;
+    double u2;
+
+    *seed = *seed * 1103515245u + 12345u;
+    u1 = ((*seed >> 8) + 1.0) / 16777217.0;
+    *seed = *seed * 1103515245u + 12345u;
+    u2 = (*seed >> 8) / 16777216.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static void synthesize(double hours)
+{
+    uint32_t seed = 2022;
+
+    count = (uint32_t)(hours * 3600.0 * 1000.0 / REPLAY_PERIOD_MS);
+    samples = (replay_sample_t *)malloc(count * sizeof(replay_sample_t));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        double s = i * (REPLAY_PERIOD_MS / 1000.0);
+        double h = s / 3600.0;
+        double cycle = fmod(s, 900.0) / 900.0;
+        double t = 21.0 + 1.5 * (h / 8.0) + 0.8 * ((cycle < 0.5) ? cycle : 1.0 - cycle) - 0.2;
+        double rh = 45.0 - 3.0 * (h / 8.0);
+
+        if (s >= 3 * 3600.0)
+        {
+            rh += 8.0 * exp(-(s - 3 * 3600.0) / 600.0);
+        }
+        t += 0.01 * noise(&seed);
+        rh += 0.03 * noise(&seed);
+
+        samples[i].timestamp = (uint32_t)(i * REPLAY_PERIOD_MS);
+        samples[i].raw.temperature = to_Code(t, 65536.0 / 165.0, 40.0);
+        samples[i].raw.humidity = to_Code(rh, 65536.0 / 100.0, 0.0);
+    }
+}
+
+static int load(const char *path)
+{
+    FILE *in = fopen(path, "r");
+    char line[256];
+    uint32_t capacity = 4096;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return 0;
+    }
+    samples = (replay_sample_t *)malloc(capacity * sizeof(replay_sample_t));
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        unsigned long timestamp;
+        unsigned temperature;
+        unsigned humidity;
+
+        if (sscanf(line, "%lu,%u,%u", &timestamp, &temperature, &humidity) != 3)
+        {
+            continue;                 /*  Header  */
+        }
+        if (count == capacity)
+        {
+            capacity *= 2;
+            samples = (replay_sample_t *)realloc(samples, capacity * sizeof(replay_sample_t));
+        }
+        samples[count].timestamp = (uint32_t)timestamp;
+        samples[count].raw.temperature = (uint16_t)temperature;
+        samples[count].raw.humidity = (uint16_t)humidity;
+        count++;
+    }
+    fclose(in);
+    return count > 1;
+}
+
+int main(int argc, char **argv)
+{
+    Deadband_c deadband;
+    hdc_raw_sample_t last = {};
+    uint16_t t_delta = (uint16_t)(REPLAY_TEMPERATURE * 65536.0f / 165.0f + 0.5f);
+    uint16_t h_delta = (uint16_t)(REPLAY_HUMIDITY * 65536.0f / 100.0f + 0.5f);
+    uint32_t last_time = 0;
+    uint32_t last_index = 0;
+    uint32_t records = 0;
+    uint64_t skipped = 0;
+    uint32_t outside = 0;
+    uint32_t worst_gap = 0;
+    double hours;
+    int failed;
+
+    if ((argc > 1) && (strstr(argv[1], ".csv") != NULL))
+    {
+        if (!load(argv[1]))
+        {
+            return 2;
+        }
+    }
+    else
+    {
+        synthesize((argc > 1) ? atof(argv[1]) : 8.0);
+    }
+    hours = (samples[count - 1].timestamp - samples[0].timestamp + REPLAY_PERIOD_MS) / 3600000.0;
+
+    deadband.Init(REPLAY_TEMPERATURE, REPLAY_HUMIDITY, REPLAY_HEARTBEAT_MS);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const hdc_raw_sample_t &raw = samples[i].raw;
+
+        if (deadband.update(raw, samples[i].timestamp))
+        {
+            if ((records != 0) && (samples[i].timestamp - last_time > worst_gap))
+            {
+                worst_gap = samples[i].timestamp - last_time;
+            }
+            records++;
+            skipped += deadband.get_Suppressed();
+            last = raw;
+            last_time = samples[i].timestamp;
+            last_index = i;
+        }
+        else if ((abs((int)raw.temperature - (int)last.temperature) > t_delta)
+                 || (abs((int)raw.humidity - (int)last.humidity) > h_delta))
+        {
+            outside++;
+        }
+    }
+    skipped += count - 1 - last_index;    /*  Trailing run, not yet carried by a record  */
+
+    printf("samples      %u over %.2f h, %u ms apart\n", count, hours, REPLAY_PERIOD_MS);
+    printf("records      %u logged, %u suppressed, longest gap %.1f s\n", records,
+           deadband.get_SuppressedTotal(), worst_gap / 1000.0);
+    printf("unfiltered   %8.0f bytes/hour (%u byte records)\n", count * (double)RECORD_PLAIN / hours, RECORD_PLAIN);
+    printf("deadband     %8.0f bytes/hour (%u byte records), %.1f %% of unfiltered\n",
+           records * (double)RECORD_FILTERED / hours, RECORD_FILTERED,
+           100.0 * records * RECORD_FILTERED / ((double)count * RECORD_PLAIN));
+
+    failed = (outside != 0) || (records + skipped != count) || (worst_gap > REPLAY_HEARTBEAT_MS + REPLAY_PERIOD_MS);
+    if (outside != 0)
+    {
+        printf("%u suppressed samples outside the deadband\n", outside);
+    }
+    printf("%s\n", failed ? "FAILED" : "passed");
+    free(samples);
+    return failed;
+}
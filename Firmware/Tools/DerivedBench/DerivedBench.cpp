@@ -0,0 +1,178 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Error and host cost of HDC2022_Derived_c against its libm reference
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -ffunction-sections -Wl,--gc-sections -DHDC2022_DERIVED_REFERENCE -DTRACE_ENABLE=0 \
+ *	    -I../HostHal -I../../STM32CubeIDE/Core/Inc DerivedBench.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/HDC2022_Derived.cpp -lm -o DerivedBench
+ *
+ *	--gc-sections drops calc_DewPoint(HDC2022_c &), the only caller of the driver, so HDC2022.cpp and a
+ *	HAL are not needed.
+ *
+ * Usage
+ *
+ *	./DerivedBench [grid step in °C and %RH] [timed rounds]
+ *
+ * Errors : every grid point of -40..125 °C x 1..100 %RH (step 0.01 by default). Dew point in °C against
+ * ref_DewPoint(), absolute humidity relative to ref_AbsoluteHumidity(), heat index in °C against the same
+ * NWS algorithm in double precision. These are the figures quoted in HDC2022_Derived.hpp.
+ *
+ * Cost : ns per call over 4096 fixed pseudo-random samples, each kernel through its out of line function,
+ * best of 5 runs. The Cortex-M4F cycle budget in the header is an estimate and is not reproduced here.
+ * Exit code is 0 when the errors stay within the header figures.
+ */
+
+#include <HDC2022_Derived.hpp>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_SAMPLES         4096
+#define BENCH_RUNS            5
+
+#define LIMIT_DEW_POINT       0.0004  /*  °C, HDC2022_Derived.hpp                                  */
+#define LIMIT_ABS_HUMIDITY    0.0005  /*  %, relative                                              */
+#define LIMIT_HEAT_INDEX      0.05    /*  °C, float rounding of the same polynomial                */
+
+typedef float (*kernel_t)(float temperature, float humidity);
+
+static float temperature[BENCH_SAMPLES];
+static float humidity[BENCH_SAMPLES];
+static volatile float sink;
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*  calc_HeatIndex() in double precision  */
+static double heat_Index(double temperature_c, double rh)
+{
+    double t = temperature_c * 1.8 + 32.0;
+    double hi = 0.5 * (t + 61.0 + (t - 68.0) * 1.2 + rh * 0.094);
+
+    if ((hi + t) * 0.5 >= 80.0)
+    {
+        hi = -42.379 + 2.04901523 * t + 10.14333127 * rh - 0.22475541 * t * rh - 6.83783e-3 * t * t
+             - 5.481717e-2 * rh * rh + 1.22874e-3 * t * t * rh + 8.5282e-4 * t * rh * rh - 1.99e-6 * t * t * rh * rh;
+        if ((rh < 13.0) && (t >= 80.0) && (t <= 112.0))
+        {
+            hi -= ((13.0 - rh) * 0.25) * sqrt((17.0 - fabs(t - 95.0)) / 17.0);
+        }
+        else if ((rh > 85.0) && (t >= 80.0) && (t <= 87.0))
+        {
+            hi += ((rh - 85.0) * 0.1) * ((87.0 - t) * 0.2);
+        }
+    }
+
+    return (hi - 32.0) / 1.8;
+}
+
+static double time_Kernel(kernel_t kernel, uint32_t rounds)
+{
+    double best = 1e30;
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        double start = now_ns();
+        float acc = 0.0f;
+
+        for (uint32_t r = 0; r < rounds; r++)
+        {
+            for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+            {
+                acc += kernel(temperature[i], humidity[i]);
+            }
+        }
+        sink = acc;
+
+        double ns = (now_ns() - start) / ((double)rounds * BENCH_SAMPLES);
+        best = (ns < best) ? ns : best;
+    }
+
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    double step = (argc > 1) ? atof(argv[1]) : 0.01;
+    uint32_t rounds = (argc > 2) ? (uint32_t)atoi(argv[2]) : 500;
+    double dew_error = 0.0;
+    double abs_error = 0.0;
+    double heat_error = 0.0;
+    float dew_at[2] = {};
+    float abs_at[2] = {};
+    uint32_t points = 0;
+    uint32_t seed = 12345;
+    int failed;
+
+    for (int it = 0; -40.0 + it * step <= 125.0 + 1e-9; it++)
+    {
+        float t = (float)(-40.0 + it * step);
+
+        for (int ih = 0; 1.0 + ih * step <= 100.0 + 1e-9; ih++)
+        {
+            float h = (float)(1.0 + ih * step);
+            double e;
+
+            e = fabs((double)HDC2022_Derived_c::calc_DewPoint(t, h) - HDC2022_Derived_c::ref_DewPoint(t, h));
+            if (e > dew_error)
+            {
+                dew_error = e;
+                dew_at[0] = t;
+                dew_at[1] = h;
+            }
+
+            e = fabs((double)HDC2022_Derived_c::calc_AbsoluteHumidity(t, h) / HDC2022_Derived_c::ref_AbsoluteHumidity(t, h) - 1.0) * 100.0;
+            if (e > abs_error)
+            {
+                abs_error = e;
+                abs_at[0] = t;
+                abs_at[1] = h;
+            }
+
+            e = fabs((double)HDC2022_Derived_c::calc_HeatIndex(t, h) - heat_Index(t, h));
+            heat_error = (e > heat_error) ? e : heat_error;
+            points++;
+        }
+    }
+
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        temperature[i] = -40.0f + (float)((seed >> 8) % 16500) * 0.01f;
+        seed = seed * 1103515245u + 12345u;
+        humidity[i] = 1.0f + (float)((seed >> 8) % 9900) * 0.01f;
+    }
+
+    printf("grid         %u points, step %g\n", points, step);
+    printf("dew point    max error %.6f °C at %.2f °C %.2f %%RH (header %g)\n", dew_error, dew_at[0], dew_at[1], LIMIT_DEW_POINT);
+    printf("abs. hum.    max error %.6f %% at %.2f °C %.2f %%RH (header %g)\n", abs_error, abs_at[0], abs_at[1], LIMIT_ABS_HUMIDITY);
+    printf("heat index   max error %.6f °C against double precision\n\n", heat_error);
+
+    printf("dew point    %5.1f ns  vs  %5.1f ns  libm\n", time_Kernel(HDC2022_Derived_c::calc_DewPoint, rounds),
+           time_Kernel(HDC2022_Derived_c::ref_DewPoint, rounds));
+    printf("abs. hum.    %5.1f ns  vs  %5.1f ns  libm\n", time_Kernel(HDC2022_Derived_c::calc_AbsoluteHumidity, rounds),
+           time_Kernel(HDC2022_Derived_c::ref_AbsoluteHumidity, rounds));
+    printf("heat index   %5.1f ns\n", time_Kernel(HDC2022_Derived_c::calc_HeatIndex, rounds));
+
+    failed = (dew_error > LIMIT_DEW_POINT) || (abs_error > LIMIT_ABS_HUMIDITY) || (heat_error > LIMIT_HEAT_INDEX);
+    printf("%s\n", failed ? "FAILED" : "passed");
+    return failed;
+}
@@ -0,0 +1,50 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        FreeRTOS configuration of HDC2022RtosSim (POSIX/Linux port)
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+/*  What HDC2022Rtos.hpp needs, see its header comment, plus the POSIX port basics  */
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configTICK_RATE_HZ                      1000
+#define configMAX_PRIORITIES                    7
+#define configMINIMAL_STACK_SIZE                ((unsigned short)4096)
+#define configMAX_TASK_NAME_LEN                 16
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   2       /*  Index 1 : HDC2022_RTOS_NOTIFY_INDEX            */
+#define configUSE_MUTEXES                       0
+#define configUSE_TIMERS                        0
+#define configQUEUE_REGISTRY_SIZE               0
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1       /*  Idle task memory, V11.1 and later                */
+#define configTOTAL_HEAP_SIZE                   (64 * 1024)
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_TRACE_FACILITY                0
+
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+
+#define configASSERT(x)                         assert(x)
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        HDC2022Rtos_c on the FreeRTOS POSIX/Linux port over the simulated I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux, FreeRTOS-Kernel V11.1 or later checked out in $K, not part of this repository)
+ *
+ *	P=$K/portable/ThirdParty/GCC/Posix
+ *	gcc -O2 -c -I. -I$K/include -I$P -I$P/utils $K/tasks.c $K/queue.c $K/list.c $P/port.c $P/utils/wait_for_event.c $K/portable/MemMang/heap_3.c
+ *	g++ -O2 -DHDC2022_USE_FREERTOS -DHDC2022_RTOS_STACK=4096 -I. -I../HDC2022Sim -I../../STM32CubeIDE/Core/Inc \
+ *	    -I$K/include -I$P -I$P/utils HDC2022RtosSim.cpp ../../STM32CubeIDE/Core/Src/HDC2022Rtos.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/HDC2022Async.cpp *.o -lpthread -o HDC2022RtosSim
+ *
+ * Usage
+ *
+ *	./HDC2022RtosSim [rounds per client] [stall every n transfers] [--no-cancel]
+ *
+ * Two client tasks share the sensor through HDC2022Rtos_c : trigger, STATUS, sample, rounds times each.
+ * The I2C interrupt is a task at the highest priority that steps the simulated device (SimDevice.hpp) every
+ * tick, so complete() and the bus task notification come from a task, as HDC2022Rtos.hpp allows. Every
+ * n-th transfer hangs past the transfer timeout and would complete late. Conversion n stores temperature
+ * code n and humidity code ~n, so a sample from a stale buffer or a mixed pair is seen. A noise task gives
+ * the clients unrelated index 0 notifications every tick, none of them may end a request early.
+ *
+ * Checked : every timeout cancelled its transfer, no transfer start was refused by a bus still busy with an
+ * aborted one, every sample is a matched pair and no client saw a conversion older than its previous one.
+ * --no-cancel binds the bus without its cancel hook, as before the fix, to show the failure.
+ * Exit code is 0 when every check passed.
+ */
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <HDC2022Rtos.hpp>
+#include "SimDevice.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_CLIENTS           2
+#define SIM_STEPS_PER_TICK    20      /*  Device steps per 1 ms tick                               */
+#define SIM_STALL_STEPS       400     /*  A hung transfer completes 20 ticks late                  */
+#define SIM_TIMEOUT_TICKS     5       /*  HDC2022Rtos_c transfer timeout                           */
+
+static sim_device_t device;
+static HDC2022Async_c sensor;
+static HDC2022Rtos_c sensor_rtos;
+static async_bus_t sim_bus;
+static async_bus_t locked_bus;
+static uint32_t rounds = 200;
+static uint32_t conversions;
+static volatile uint32_t refused;
+static volatile uint32_t clients_done;
+static TaskHandle_t client_tasks[SIM_CLIENTS];
+static volatile uint8_t client_finished[SIM_CLIENTS];
+static volatile uint32_t noise;
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t errors;
+    uint32_t mismatched;              /*  humidity != ~temperature                                 */
+    uint32_t stale;                   /*  Older conversion than the previous sample                */
+} client_stats_t;
+
+static client_stats_t client_stats[SIM_CLIENTS];
+
+/*  The device is shared with the interrupt task, every access runs with the scheduler suspended  */
+static uint8_t locked_Read(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t started;
+
+    vTaskSuspendAll();
+    started = sim_Read(ctx, reg, buf, len);
+    refused = refused + !started;
+    xTaskResumeAll();
+    return started;
+}
+
+static uint8_t locked_Write(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t started;
+
+    vTaskSuspendAll();
+    started = sim_Write(ctx, reg, buf, len);
+    refused = refused + !started;
+    xTaskResumeAll();
+    return started;
+}
+
+static void locked_Cancel(void *ctx)
+{
+    vTaskSuspendAll();
+    sim_Cancel(ctx);
+    xTaskResumeAll();
+}
+
+/*  Plays the I2C interrupt : steps the device, completions notify the bus task  */
+static void irq_Task(void *arg)
+{
+    (void)arg;
+    while (1)
+    {
+        vTaskDelay(1);
+        vTaskSuspendAll();
+        for (uint32_t i = 0; i < SIM_STEPS_PER_TICK; i++)
+        {
+            if (device.conversion == 1)
+            {
+                conversions++;
+                device.next_temperature = (uint16_t)conversions;
+                device.next_humidity = (uint16_t)~conversions;
+            }
+            sim_Step(&device);
+        }
+        xTaskResumeAll();
+    }
+}
+
+/*  Application notifications on index 0, e.g. an event flag of another task  */
+static void noise_Task(void *arg)
+{
+    (void)arg;
+    while (clients_done < SIM_CLIENTS)
+    {
+        vTaskDelay(1);
+        vTaskSuspendAll();
+        for (int c = 0; c < SIM_CLIENTS; c++)
+        {
+            if (!client_finished[c])
+            {
+                xTaskNotifyGive(client_tasks[c]);
+                noise = noise + 1;
+            }
+        }
+        xTaskResumeAll();
+    }
+    vTaskDelete(NULL);
+}
+
+static void client_Task(void *arg)
+{
+    client_stats_t *stats = (client_stats_t *)arg;
+    HDC2022Async_c::raw_sample_t raw;
+    uint16_t last = 0;
+    uint8_t status;
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        if (sensor_rtos.trigger_Measurement(0x00) != ASYNC_DONE)
+        {
+            stats->errors++;
+            continue;
+        }
+        vTaskDelay(1);
+        if (sensor_rtos.read_Status(&status) != ASYNC_DONE)
+        {
+            stats->errors++;
+        }
+        if (sensor_rtos.read_Sample(&raw) != ASYNC_DONE)
+        {
+            stats->errors++;
+            continue;
+        }
+        stats->samples++;
+        stats->mismatched += (raw.humidity != (uint16_t)~raw.temperature);
+        stats->stale += (raw.temperature < last);
+        last = raw.temperature;
+    }
+
+    vTaskSuspendAll();
+    client_finished[stats - client_stats] = 1;
+    clients_done = clients_done + 1;
+    xTaskResumeAll();
+    vTaskDelete(NULL);
+}
+
+static void check_Task(void *arg)
+{
+    client_stats_t total = {};
+    uint32_t timeouts;
+    int failed;
+
+    (void)arg;
+    while (clients_done < SIM_CLIENTS)
+    {
+        vTaskDelay(10);
+    }
+
+    for (int c = 0; c < SIM_CLIENTS; c++)
+    {
+        total.samples += client_stats[c].samples;
+        total.errors += client_stats[c].errors;
+        total.mismatched += client_stats[c].mismatched;
+        total.stale += client_stats[c].stale;
+    }
+    timeouts = sensor_rtos.get_Timeouts();
+    failed = (device.cancelled != timeouts) || (refused != 0) || (total.mismatched != 0) || (total.stale != 0);
+
+    printf("requests     %u rounds x %d clients\n", rounds, SIM_CLIENTS);
+    printf("samples      %u, failed requests %u\n", total.samples, total.errors);
+    printf("timeouts     %u, cancelled transfers %u\n", timeouts, device.cancelled);
+    printf("refused      %u transfer starts on a busy bus\n", refused);
+    printf("noise        %u index 0 notifications to the clients\n", noise);
+    printf("mismatched   %u, stale %u\n", total.mismatched, total.stale);
+    printf("%s\n", failed ? "FAILED" : "passed");
+
+    exit(failed ? 1 : 0);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t cancel = 1;
+
+    rounds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    sim_Bind(&device, &sensor, &sim_bus);
+    device.latency = 4;
+    device.stall_every = (argc > 2) ? (uint32_t)atoi(argv[2]) : 13;
+    device.stall_steps = SIM_STALL_STEPS;
+    for (int i = 3; i < argc; i++)
+    {
+        cancel = cancel && (strcmp(argv[i], "--no-cancel") != 0);
+    }
+
+    locked_bus.read = locked_Read;
+    locked_bus.write = locked_Write;
+    locked_bus.ctx = &device;
+    locked_bus.cancel = cancel ? locked_Cancel : NULL;
+    sensor.Init(&locked_bus);
+
+    sensor_rtos.Init(&sensor, tskIDLE_PRIORITY + 4, SIM_TIMEOUT_TICKS);
+    xTaskCreate(irq_Task, "irq", configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 1, NULL);
+    for (int c = 0; c < SIM_CLIENTS; c++)
+    {
+        xTaskCreate(client_Task, "client", configMINIMAL_STACK_SIZE, &client_stats[c], tskIDLE_PRIORITY + 2,
+                    &client_tasks[c]);
+    }
+    xTaskCreate(noise_Task, "noise", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, NULL);
+    xTaskCreate(check_Task, "check", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL);
+
+    vTaskStartScheduler();
+    return 1;
+}
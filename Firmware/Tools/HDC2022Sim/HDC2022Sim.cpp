@@ -0,0 +1,300 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host simulation of the HDC2022 async acquisition over a simulated I2C bus
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -I../../STM32CubeIDE/Core/Inc HDC2022Sim.cpp ../../STM32CubeIDE/Core/Src/HDC2022Async.cpp -o HDC2022Sim
+ *
+ * Usage
+ *
+ *	./HDC2022Sim [samples] [bus latency in steps] [error every n transfers]
+ *	./HDC2022Sim --restart [reset time in us] [runs]
+ *	./HDC2022Sim --peaks [read every n conversions] [conversions] [reset every n reads]
+ *
+ * The simulated device (SimDevice.hpp, shared with HDC2022RtosSim) keeps a register file, completes every
+ * transfer after the given number of event loop steps and raises DRDY a few steps after MEAS_TRIG. The
+ * acquisition is the same async sequence as the firmware (trigger, STATUS, 4 byte burst), the decoded
+ * codes are checked against the device.
+ * Exit code is 0 when every sample matches.
+ *
+ * --restart runs HDC2022Async_c::restart() against a device that NACKs for the given reset time after
+ * SOFT_RES and comes back with its reset values. One step is one SCL period at 100 kHz (10 us), a transfer
+ * takes its START, address, register, data and STOP bits, a NACKed one its address byte. The downtime is
+ * from the SOFT_RES write to the end of the restore, the restored registers are checked. For comparison the
+ * same sequence with the 9 registers written one by one (as Init() used to) is derived from the same model.
+ *
+ * --peaks triggers one-shot conversions of a temperature with short spikes and reads only every n-th with
+ * read_Peaks(), resetting the maxima with restart() every few reads, like the firmware's PEAK_MONITOR mode.
+ * The device keeps TEMPERATURE_MAX / HUMIDITY_MAX as the high byte of the largest code since the last
+ * reset. Transactions and bus time (same wire model) are compared with reading every conversion
+ * (trigger, STATUS, 4 byte burst), the maxima are checked and the spikes seen by the peak-hold alarm are
+ * counted against the ones visible in the read samples alone.
+ */
+
+#include <HDC2022Async.hpp>
+#include "SimDevice.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static sim_device_t device;
+static HDC2022Async_c sensor;
+static async_bus_t sim_bus;
+
+static void sim_Step(void)
+{
+    sim_Step(&device);
+}
+
+static async_t pt_acquire, pt_op;
+static HDC2022Async_c::raw_sample_t raw;
+static uint8_t status;
+
+/*  Same sequence as the firmware, straight-line over the simulated bus  */
+static uint8_t acquire(void)
+{
+    ASYNC_BEGIN(&pt_acquire);
+
+    ASYNC_CALL(&pt_acquire, &pt_op, sensor.trigger_Measurement(&pt_op, 0x00));
+    do
+    {
+        ASYNC_CALL(&pt_acquire, &pt_op, sensor.read_Status(&pt_op, &status));
+    } while ((status & 0x80) == 0);
+    ASYNC_CALL(&pt_acquire, &pt_op, sensor.read_Sample(&pt_op, &raw));
+
+    ASYNC_END(&pt_acquire);
+}
+
+/**
+ * @brief  Restart Downtime
+ * @note   Runs restart() from a configured device, checks the restored registers
+ * @param  uint32_t reset_us	:	Device NACK time after SOFT_RES
+ * @param  uint32_t runs
+ * @retval int				:	0 = every run restored the configuration
+ */
+static int restart_Mode(uint32_t reset_us, uint32_t runs)
+{
+    static async_t pt_restart;
+    uint8_t configuration[9];
+    uint32_t worst = 0, best = 0xFFFFFFFF, failed = 0;
+    uint64_t total = 0;
+    uint32_t burst = wire_Bits(9, 1);
+    uint32_t single = 9 * wire_Bits(1, 1);
+
+    device.wire = 1;
+    device.reset_steps = reset_us / 10;
+
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        uint32_t steps = 0;
+        uint8_t result;
+
+        for (int i = 0; i < 9; i++)
+        {
+            configuration[i] = (uint8_t)(0x11 * (i + 1) + run);
+        }
+        configuration[7] &= 0x7F;               /*  DEVICE_CONFIGURATION without SOFT_RES                */
+        configuration[8] &= 0xFE;               /*  MEASUREMENT_CONFIGURATION without MEAS_TRIG          */
+        memcpy(&device.regs[0x07], configuration, 9);
+
+        do
+        {
+            result = sensor.restart(&pt_restart, configuration);
+            if (result == ASYNC_RUNNING)
+            {
+                sim_Step();
+                steps++;
+            }
+        } while (result == ASYNC_RUNNING);
+
+        if ((result != ASYNC_DONE) || memcmp(&device.regs[0x07], configuration, 9) != 0)
+        {
+            failed++;
+        }
+        while (device.countdown != 0 || device.resetting != 0)
+        {
+            sim_Step();                         /*  Let a run that gave up finish before the next one    */
+        }
+        total += steps;
+        worst = (steps > worst) ? steps : worst;
+        best = (steps < best) ? steps : best;
+        device.regs[0x07] ^= 0xFF;              /*  Next run must restore again                          */
+    }
+
+    printf("reset time      %u us (device model)\n", reset_us);
+    printf("runs            %u, failed %u\n", runs, failed);
+    printf("downtime        %.0f us average, %u .. %u us\n", total * 10.0 / runs, best * 10, worst * 10);
+    printf("restore         %u us as one burst, %u us as 9 single writes\n", burst * 10, single * 10);
+    printf("9 single writes %.0f us average downtime (same reset and polls)\n", (total * 10.0 / runs) + (single - burst) * 10);
+
+    return (failed == 0) ? 0 : 1;
+}
+
+/*  Runs one async operation to its end, counts its device steps (10 us each in the wire model)  */
+template<typename OPERATION>
+static uint8_t run_Operation(OPERATION operation, uint64_t &steps)
+{
+    uint8_t result;
+
+    while ((result = operation()) == ASYNC_RUNNING)
+    {
+        sim_Step();
+        steps++;
+    }
+    while (device.countdown != 0 || device.conversion != 0)
+    {
+        sim_Step();                             /*  Conversion time is not bus time                        */
+    }
+    return result;
+}
+
+/**
+ * @brief  Peak Monitoring
+ * @note   One-shot conversions, read_Peaks() every read_every conversions, restart() every reset_reads reads
+ * @param  uint32_t read_every
+ * @param  uint32_t conversions
+ * @param  uint32_t reset_reads
+ * @retval int				:	0 = every read returned the expected maxima and no spike was missed
+ */
+static int peaks_Mode(uint32_t read_every, uint32_t conversions, uint32_t reset_reads)
+{
+    static async_t pt;
+    static HDC2022Async_c::peak_sample_t peaks;
+    const uint8_t threshold = 0x70;            /*  TEMPERATURE_THRESHOLD_HIGH code, about 32.2 °C         */
+    uint8_t configuration[9] = { 0x40, 0x00, 0x00, 0x01, threshold, 0x00, 0xFF, 0x06, 0x00 };
+    uint8_t max_temperature = 0, max_humidity = 0, window_spike = 0;
+    uint32_t reads = 0, wrong = 0, spikes = 0, seen_peak = 0, seen_sample = 0, failed = 0;
+    uint64_t steps = 0;
+
+    device.wire = 1;
+    device.reset_steps = 300;
+    memcpy(&device.regs[0x07], configuration, 9);
+
+    for (uint32_t c = 0; c < conversions; c++)
+    {
+        uint8_t spike = ((c % 97) < 2);         /*  Two conversions of every 97 well above the threshold   */
+
+        device.next_temperature = (uint16_t)(0x6000 + ((c * 37) & 0x1FF) + (spike ? 0x1800 : 0));
+        device.next_humidity = (uint16_t)(0x7000 + ((c * 53) & 0x3FF));
+        max_temperature = ((device.next_temperature >> 8) > max_temperature) ? (uint8_t)(device.next_temperature >> 8) : max_temperature;
+        max_humidity = ((device.next_humidity >> 8) > max_humidity) ? (uint8_t)(device.next_humidity >> 8) : max_humidity;
+        spikes += (spike && !window_spike);
+        window_spike |= spike;
+
+        failed += (run_Operation([&]() { return sensor.trigger_Measurement(&pt, configuration[8]); }, steps) != ASYNC_DONE);
+        if (((c + 1) % read_every) != 0)
+        {
+            continue;
+        }
+
+        failed += (run_Operation([&]() { return sensor.read_Peaks(&pt, &peaks); }, steps) != ASYNC_DONE);
+        wrong += (peaks.temperature_max != max_temperature) || (peaks.humidity_max != max_humidity) ||
+                 (peaks.last.temperature != device.next_temperature) || !(peaks.status & 0x80);
+        seen_peak += window_spike && (peaks.temperature_max > threshold);
+        seen_sample += window_spike && ((peaks.last.temperature >> 8) > threshold);
+        window_spike = 0;
+
+        if ((++reads % reset_reads) == 0)
+        {
+            failed += (run_Operation([&]() { return sensor.restart(&pt, configuration); }, steps) != ASYNC_DONE);
+            max_temperature = 0;
+            max_humidity = 0;
+        }
+    }
+
+    uint32_t continuous = 3 * conversions;
+    uint64_t continuous_steps = (uint64_t)conversions * (wire_Bits(1, 1) + wire_Bits(1, 0) + wire_Bits(4, 0));
+
+    printf("conversions     %u, read every %u, maxima reset every %u reads\n", conversions, read_every, reset_reads);
+    printf("reads           %u, wrong %u, failed operations %u\n", reads, wrong, failed);
+    printf("transactions    %u peak mode (%.2f per conversion), %u reading every conversion (%.1f%%)\n",
+           device.transfers, (double)device.transfers / conversions, continuous, 100.0 * device.transfers / continuous);
+    printf("bus time        %.1f ms peak mode, %.1f ms reading every conversion\n", steps / 100.0, continuous_steps / 100.0);
+    printf("spike windows   %u, peak-hold alarm %u, last sample only %u\n", spikes, seen_peak, seen_sample);
+
+    return ((wrong == 0) && (failed == 0) && (seen_peak == spikes)) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc > 1) && (strcmp(argv[1], "--restart") == 0))
+    {
+        sim_Bind(&device, &sensor, &sim_bus);
+        return restart_Mode((argc > 2) ? (uint32_t)atoi(argv[2]) : 3000, (argc > 3) ? (uint32_t)atoi(argv[3]) : 1000);
+    }
+    if ((argc > 1) && (strcmp(argv[1], "--peaks") == 0))
+    {
+        sim_Bind(&device, &sensor, &sim_bus);
+        return peaks_Mode((argc > 2) ? (uint32_t)atoi(argv[2]) : 10, (argc > 3) ? (uint32_t)atoi(argv[3]) : 6000,
+                          (argc > 4) ? (uint32_t)atoi(argv[4]) : 60);
+    }
+
+    uint32_t samples = (argc > 1) ? (uint32_t)atoi(argv[1]) : 100000;
+    uint32_t good = 0, errors = 0, mismatches = 0;
+    uint64_t resumes = 0, steps = 0;
+    struct timespec t0, t1;
+    double seconds;
+
+    sim_Bind(&device, &sensor, &sim_bus);
+    device.latency = (argc > 2) ? (uint32_t)atoi(argv[2]) : 4;
+    device.error_every = (argc > 3) ? (uint32_t)atoi(argv[3]) : 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (good + errors < samples)
+    {
+        uint8_t result;
+
+        device.next_temperature = (uint16_t)(0x6000 + (good * 7));
+        device.next_humidity = (uint16_t)(0x8000 - (good * 5));
+        do
+        {
+            result = acquire();
+            resumes++;
+            if (result == ASYNC_RUNNING)
+            {
+                sim_Step();
+                steps++;
+            }
+        } while (result == ASYNC_RUNNING);
+
+        while (device.countdown != 0 || device.conversion != 0)
+        {
+            sim_Step();                         /*  Drain a failed transfer before the next sample  */
+        }
+
+        if (result != ASYNC_DONE)
+        {
+            errors++;
+            continue;
+        }
+        if (raw.temperature != device.next_temperature || raw.humidity != device.next_humidity)
+        {
+            mismatches++;
+        }
+        good++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+    printf("samples      %u\n", good);
+    printf("errors       %u (driver counted %u)\n", errors, sensor.get_Statistics().errors);
+    printf("mismatches   %u\n", mismatches);
+    printf("transfers    %u\n", device.transfers);
+    printf("resumes      %llu (%.1f per sample)\n", (unsigned long long)resumes, (double)resumes / samples);
+    printf("throughput   %.0f samples/s, %.1f ns per resume incl. device step\n", samples / seconds,
+           seconds * 1e9 / (double)(resumes + steps));
+
+    return (mismatches == 0) ? 0 : 1;
+}
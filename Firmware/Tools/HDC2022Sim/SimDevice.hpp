@@ -0,0 +1,185 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Simulated HDC2022 on a simulated I2C bus, shared by the host tools
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _SIMDEVICE_HPP_
+#define _SIMDEVICE_HPP_
+
+/*
+ * The device keeps a register file and completes every transfer after a number of event loop steps,
+ * sim_Step() plays the role of the I2C interrupt and calls HDC2022Async_c::complete(). Used by
+ * HDC2022Sim and HDC2022RtosSim, bind it with sim_Bind().
+ */
+
+#include <HDC2022Async.hpp>
+#include <string.h>
+
+typedef struct
+{
+    uint8_t  regs[256];
+    uint32_t latency;                   /*  Steps from start to completion                       */
+    uint32_t error_every;               /*  0 = never fail                                       */
+    uint32_t transfers;
+    uint32_t countdown;                 /*  Steps left for the transfer in flight, 0 = idle      */
+    uint32_t conversion;                /*  Steps left for the conversion, 0 = idle              */
+    uint8_t  write;
+    uint8_t  reg;
+    uint8_t  *buf;
+    uint16_t len;
+    uint8_t  fail;
+    uint16_t next_temperature;
+    uint16_t next_humidity;
+    uint8_t  wire;                      /*  1 = latency from the bits on the wire, 1 step = 10 us  */
+    uint32_t reset_steps;               /*  NACK time after SOFT_RES                             */
+    uint32_t resetting;                 /*  Steps left of the reset, 0 = answering               */
+    uint32_t stall_every;               /*  0 = never, else every n-th transfer hangs ...        */
+    uint32_t stall_steps;               /*  ... and completes this many steps late               */
+    uint32_t cancelled;                 /*  Transfers dropped through sim_Cancel()               */
+    HDC2022Async_c *sensor;             /*  Completion target                                    */
+} sim_device_t;
+
+/*  SCL periods of one register transfer, a read has a repeated START and a second address byte  */
+static uint32_t wire_Bits(uint16_t len, uint8_t write)
+{
+    return write ? 1 + (2 + len) * 9 + 1 : 1 + 2 * 9 + 1 + (1 + len) * 9 + 1;
+}
+
+static uint8_t sim_Start(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len, uint8_t write)
+{
+    sim_device_t *d = (sim_device_t *)ctx;
+
+    if (d->countdown != 0)
+    {
+        return 0;
+    }
+    d->transfers++;
+    d->reg = reg;
+    d->buf = buf;
+    d->len = len;
+    d->write = write;
+    d->fail = (d->error_every != 0) && ((d->transfers % d->error_every) == 0);
+    d->countdown = d->latency + 1;
+    if (d->wire)
+    {
+        d->fail = (d->resetting != 0);
+        d->countdown = d->fail ? 1 + 9 + 1 : wire_Bits(len, write);
+    }
+    if ((d->stall_every != 0) && ((d->transfers % d->stall_every) == 0))
+    {
+        d->countdown += d->stall_steps;
+    }
+
+    return 1;
+}
+
+static uint8_t sim_Read(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return sim_Start(ctx, reg, buf, len, 0);
+}
+
+static uint8_t sim_Write(void *ctx, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return sim_Start(ctx, reg, buf, len, 1);
+}
+
+/*  The bus drops the transfer in flight and completes it as failed, like I2CBus_c::cancel() on the target  */
+static void sim_Cancel(void *ctx)
+{
+    sim_device_t *d = (sim_device_t *)ctx;
+
+    if (d->countdown != 0)
+    {
+        d->countdown = 0;
+        d->cancelled++;
+        d->sensor->complete(0);
+    }
+}
+
+/*  One event loop step of the device, plays the role of the I2C interrupt  */
+static void sim_Step(sim_device_t *d)
+{
+
+    if (d->resetting != 0)
+    {
+        d->resetting--;
+    }
+    if (d->conversion != 0 && --d->conversion == 0)
+    {
+        d->regs[0x00] = (uint8_t)d->next_temperature;
+        d->regs[0x01] = (uint8_t)(d->next_temperature >> 8);
+        d->regs[0x02] = (uint8_t)d->next_humidity;
+        d->regs[0x03] = (uint8_t)(d->next_humidity >> 8);
+        d->regs[0x04] |= 0x80;
+        if ((uint8_t)(d->next_temperature >> 8) > d->regs[0x05])
+        {
+            d->regs[0x05] = (uint8_t)(d->next_temperature >> 8);
+        }
+        if ((uint8_t)(d->next_humidity >> 8) > d->regs[0x06])
+        {
+            d->regs[0x06] = (uint8_t)(d->next_humidity >> 8);
+        }
+    }
+
+    if (d->countdown == 0 || --d->countdown != 0)
+    {
+        return;
+    }
+
+    if (!d->fail)
+    {
+        for (uint16_t i = 0; i < d->len; i++)
+        {
+            uint8_t r = (uint8_t)(d->reg + i);
+
+            if (d->write)
+            {
+                d->regs[r] = d->buf[i];
+            }
+            else
+            {
+                d->buf[i] = d->regs[r];
+            }
+        }
+        if (!d->write && d->reg == 0x04)
+        {
+            d->regs[0x04] = 0;                  /*  STATUS clears on read  */
+        }
+        if (d->write && d->reg == 0x0F && (d->buf[0] & 0x01))
+        {
+            d->conversion = 3;
+        }
+        if (d->write && d->reg <= 0x0E && d->reg + d->len > 0x0E && (d->regs[0x0E] & 0x80))
+        {
+            memset(&d->regs[0x04], 0, 0x0C);    /*  SOFT_RES : reset values, DRDY and SOFT_RES cleared  */
+            d->regs[0x0A] = 0x01;
+            d->regs[0x0B] = 0xFF;
+            d->regs[0x0D] = 0xFF;
+            d->conversion = 0;
+            d->resetting = d->reset_steps;
+        }
+    }
+    d->sensor->complete(!d->fail);
+}
+
+/*  Clears the device, binds it to sensor as its bus  */
+static void sim_Bind(sim_device_t *d, HDC2022Async_c *sensor, async_bus_t *bus)
+{
+    memset(d, 0, sizeof(*d));
+    d->sensor = sensor;
+    bus->read = sim_Read;
+    bus->write = sim_Write;
+    bus->ctx = d;
+    bus->cancel = sim_Cancel;
+    sensor->Init(bus);
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Flash / RAM of HDC2022Fixed_c against HDC2022_c for the same application
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (arm-none-eabi, from this directory)
+ *
+ *	ARM="arm-none-eabi-g++ -mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard -Os -std=gnu++14 \
+ *	    -fno-exceptions -fno-rtti -ffunction-sections -fdata-sections -DUSE_HAL_DRIVER -DSTM32L476xx \
+ *	    -DTRACE_ENABLE=0 -I../../STM32CubeIDE/Core/Inc -I../../STM32CubeIDE/Drivers/STM32L4xx_HAL_Driver/Inc \
+ *	    -I../../STM32CubeIDE/Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../../STM32CubeIDE/Drivers/CMSIS/Include \
+ *	    --specs=nano.specs --specs=nosys.specs -nostartfiles \
+ *	    -Wl,--gc-sections,-e,size_Main,--unresolved-symbols=ignore-all"
+ *
+ *	$ARM -DHDC2022_SIZE_FIXED=1 HDC2022Size.cpp -o fixed.elf
+ *	$ARM -DHDC2022_SIZE_FIXED=0 HDC2022Size.cpp ../../STM32CubeIDE/Core/Src/HDC2022.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/I2CBus.cpp -o runtime.elf
+ *	arm-none-eabi-size fixed.elf runtime.elf
+ *	arm-none-eabi-nm --size-sort -C runtime.elf
+ *
+ * Without the ARM toolchain the same two builds run with g++ -no-pie and -I../HostHal in place of the HAL
+ * and CMSIS paths (drop the -m and --specs flags and the USE_HAL_DRIVER / STM32L476xx defines) for an x86
+ * figure of the same comparison.
+ *
+ * Both builds run one application : 1 Hz auto mode, 14 bit, temperature and humidity, DRDY on the pin,
+ * raw codes read on DRDY. size_Main() is the entry point so --gc-sections keeps only what it reaches,
+ * the HAL is left unresolved, so text / data / bss are the driver and its configuration only, not the
+ * HAL, startup or libc, and the two numbers compare directly. The ELFs are for arm-none-eabi-size and
+ * nm, they do not run.
+ */
+
+#include <HDC2022Fixed.hpp>
+
+#ifndef HDC2022_SIZE_FIXED
+#define HDC2022_SIZE_FIXED    1
+#endif
+
+I2C_HandleTypeDef hi2c1;
+volatile uint32_t size_sink;
+
+#if HDC2022_SIZE_FIXED
+
+typedef HDC2022Fixed_c<HDC2022_c::RATE_1HZ, HDC_RES_14BIT, HDC_CH_BOTH, 1, HDC_FORMAT_RAW> Sensor_t;
+
+Sensor_t Sensor;
+
+extern "C" int size_Main(void)
+{
+    Sensor_t::sample_t sample;
+
+    Sensor.Init(hi2c1, 10);
+    while (1)
+    {
+        if (Sensor.data_Ready() && (Sensor.read_Sample(sample) == HAL_OK))
+        {
+            size_sink = ((uint32_t)sample.humidity << 16) | sample.temperature;
+        }
+    }
+}
+
+#else
+
+typedef HDC2022Map::DEVICE_CONFIGURATION DEVCFG;
+
+HDC2022_c Sensor;
+
+extern "C" int size_Main(void)
+{
+    HDC2022_c::raw_sample_t sample;
+
+    Sensor.Init(hi2c1, 10);
+    Sensor.write_Fields(HDC2022Map::INTERRUPT_ENABLE::DRDY_ENABLE::value(1));
+    Sensor.write_Fields(DEVCFG::CC::value(HDC2022_c::RATE_1HZ) | DEVCFG::INT_POL::value(1) | DEVCFG::DRDY_INT_EN::value(1));
+    Sensor.write_Fields(HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::value(1));
+    while (1)
+    {
+        if (Sensor.read_Field<HDC2022Map::STATUS::DRDY_STATUS>() && (Sensor.get_Sample(sample) == HDC2022_c::RESULT_OK))
+        {
+            size_sink = ((uint32_t)sample.humidity << 16) | sample.temperature;
+        }
+    }
+}
+
+#endif
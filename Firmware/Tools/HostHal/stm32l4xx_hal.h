@@ -0,0 +1,226 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host stand-in for the STM32L4 HAL subset used by the HDC2022 drivers
+ @
+ @   Version            :        1.0.0
+ */
+
+#ifndef _HOST_STM32L4XX_HAL_H_
+#define _HOST_STM32L4XX_HAL_H_
+
+/*
+ *  Lets the driver sources (HDC2022.cpp, HDC2022_Derived.cpp, HDC2022Fixed.hpp, RtcClock.cpp) compile
+ *  unchanged on the host : put this directory before Core/Inc on the include path and build with -DTRACE_ENABLE=0.
+ *  Only types, constants and prototypes are here. The tool that links a driver defines the functions it
+ *  calls, so each tool decides what the bus does (see Tools/I2CFaultSim). USE_HAL_DRIVER stays undefined,
+ *  which keeps RAM2_FUNC and the interrupt paths of HDC2022Async_c out of host builds.
+ *
+ *  RTC and RCC are plain register images (host_rtc, host_rcc), no calendar runs : the tool sets the flags
+ *  the code waits for (RTC_ISR_INITF) and reads back the TR / DR values the code wrote.
+ *
+ *  DWT->CYCCNT is a virtual cycle counter owned by the tool : every read calls host_Cycles(), so busy
+ *  waits such as delay_us() in HDC2022.cpp make progress and the tool can advance time in its HAL calls.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+  HAL_OK       = 0x00,
+  HAL_ERROR    = 0x01,
+  HAL_BUSY     = 0x02,
+  HAL_TIMEOUT  = 0x03,
+}HAL_StatusTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET,
+}GPIO_PinState;
+
+typedef struct
+{
+  uint32_t id;                        /*  Port number, host only                                     */
+}GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+}GPIO_InitTypeDef;
+
+typedef struct
+{
+  void *Instance;
+  volatile uint32_t ErrorCode;
+  volatile uint32_t State;
+}I2C_HandleTypeDef;
+
+typedef enum
+{
+  I2C1_EV_IRQn = 31,
+  I2C1_ER_IRQn = 32,
+}IRQn_Type;
+
+#define GPIO_PIN_6                ((uint16_t)0x0040)
+#define GPIO_PIN_7                ((uint16_t)0x0080)
+#define GPIO_PIN_8                ((uint16_t)0x0100)
+#define GPIO_MODE_OUTPUT_OD       0x00000011U
+#define GPIO_PULLUP               0x00000001U
+#define GPIO_SPEED_FREQ_HIGH      0x00000002U
+
+#define I2C_MEMADD_SIZE_8BIT      0x00000001U
+
+#define HAL_I2C_ERROR_NONE        0x00000000U
+#define HAL_I2C_ERROR_BERR        0x00000001U
+#define HAL_I2C_ERROR_ARLO        0x00000002U
+#define HAL_I2C_ERROR_AF          0x00000004U
+#define HAL_I2C_ERROR_OVR         0x00000008U
+#define HAL_I2C_ERROR_DMA         0x00000010U
+#define HAL_I2C_ERROR_TIMEOUT     0x00000020U
+
+#define I2C_TIMEOUT_BUSY          25U         /*  stm32l4xx_hal_i2c.c : wait for a free bus, ms          */
+
+extern GPIO_TypeDef host_gpiob;
+#define GPIOB                     (&host_gpiob)
+
+extern uint32_t SystemCoreClock;
+
+uint32_t host_Cycles(void);
+
+typedef struct
+{
+  operator uint32_t() const           { return host_Cycles(); }
+}host_cyccnt_t;
+
+typedef struct
+{
+  volatile uint32_t CTRL;
+  host_cyccnt_t CYCCNT;
+}DWT_Type;
+
+typedef struct
+{
+  volatile uint32_t DEMCR;
+}CoreDebug_Type;
+
+typedef struct
+{
+  volatile uint32_t TER;
+  union
+  {
+    volatile uint32_t u32;
+  }PORT[32];
+}ITM_Type;
+
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+extern ITM_Type host_itm;
+#define DWT                       (&host_dwt)
+#define CoreDebug                 (&host_core_debug)
+#define ITM                       (&host_itm)
+#define DWT_CTRL_CYCCNTENA_Msk    0x00000001U
+#define CoreDebug_DEMCR_TRCENA_Msk 0x01000000U
+
+typedef struct
+{
+  volatile uint32_t TR;
+  volatile uint32_t DR;
+  volatile uint32_t CR;
+  volatile uint32_t ISR;
+  volatile uint32_t PRER;
+  volatile uint32_t WPR;
+  volatile uint32_t SSR;
+}RTC_TypeDef;
+
+typedef struct
+{
+  volatile uint32_t BDCR;
+}RCC_TypeDef;
+
+extern RTC_TypeDef host_rtc;
+extern RCC_TypeDef host_rcc;
+#define RTC                       (&host_rtc)
+#define RCC                       (&host_rcc)
+
+#define RTC_TR_HT_Pos             20U
+#define RTC_TR_HU_Pos             16U
+#define RTC_TR_MNT_Pos            12U
+#define RTC_TR_MNU_Pos            8U
+#define RTC_TR_ST_Pos             4U
+#define RTC_TR_SU_Pos             0U
+#define RTC_DR_YT_Pos             20U
+#define RTC_DR_YU_Pos             16U
+#define RTC_DR_WDU_Pos            13U
+#define RTC_DR_MT_Pos             12U
+#define RTC_DR_MU_Pos             8U
+#define RTC_DR_DT_Pos             4U
+#define RTC_DR_DU_Pos             0U
+#define RTC_CR_BYPSHAD            0x00000020U
+#define RTC_ISR_INITS             0x00000010U
+#define RTC_ISR_INITF             0x00000040U
+#define RTC_ISR_INIT              0x00000080U
+#define RTC_PRER_PREDIV_A_Pos     16U
+#define RCC_BDCR_RTCEN            0x00008000U
+
+#define RCC_LSE_TIMEOUT_VALUE     5000U
+#define __HAL_RCC_PWR_CLK_ENABLE()            do { } while (0)
+#define __HAL_RCC_LSEDRIVE_CONFIG(drive)      do { } while (0)
+#define __HAL_RCC_LSE_CONFIG(state)           do { } while (0)
+#define __HAL_RCC_RTC_CONFIG(source)          do { } while (0)
+#define __HAL_RCC_RTC_ENABLE()                (RCC->BDCR |= RCC_BDCR_RTCEN)
+#define __HAL_RCC_GET_FLAG(flag)              1U
+
+void HAL_PWR_EnableBkUpAccess(void);
+
+static inline void __disable_irq(void)    { }
+static inline void __enable_irq(void)     { }
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+
+uint32_t HAL_GetTick(void);
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub);
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init);
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin);
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t address, uint32_t trials, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size,
+                                          uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size,
+                                         uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                    uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                   uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                       uint8_t *data, uint16_t size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                      uint8_t *data, uint16_t size);
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,395 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Fault injection into HDC2022_c retry and bus recovery on a stubbed HAL
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -DTRACE_ENABLE=0 -I../HostHal -I../../STM32CubeIDE/Core/Inc I2CFaultSim.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/HDC2022.cpp ../../STM32CubeIDE/Core/Src/I2CBus.cpp -o I2CFaultSim
+ *
+ * Usage
+ *
+ *	./I2CFaultSim [i2c timeout in ms]
+ *
+ * HDC2022.cpp runs unchanged on the blocking HAL path (no I2CBus_c attached) against the HAL of
+ * Tools/HostHal, implemented here as a device on a 100 kHz bus with a virtual 80 MHz cycle counter. Each
+ * scenario scripts the outcome of the successive HAL_I2C_Mem_Read/Write calls of one get_Status() :
+ *
+ *	NACK      address not acknowledged, HAL_ERROR with HAL_I2C_ERROR_AF after the address byte
+ *	TIMEOUT   slave stretches SCL, HAL_ERROR with HAL_I2C_ERROR_TIMEOUT after timeout + 1 tick
+ *	BERR      misplaced START/STOP, HAL_ERROR with HAL_I2C_ERROR_BERR after the register byte
+ *	ARLO      arbitration lost, HAL_ERROR with HAL_I2C_ERROR_ARLO after the register byte
+ *	STUCK n   slave holds SDA low until n SCL clocks : every call waits I2C_TIMEOUT_BUSY for a free bus,
+ *	          then HAL_ERROR with HAL_I2C_ERROR_TIMEOUT, as stm32l4xx_hal_i2c.c does
+ *
+ * Checked per scenario : the result, the retry and recovery counts of get_Statistics(), one
+ * HAL_I2C_DeInit/Init pair per recovery, the SCL edges clocked by I2C_recover(), every recovery within
+ * 0.2 ms and the latency of the call and worst_cycles within the worst case of the I2C_transfer() note,
+ *
+ *	(retries + 1) * (max(i2c_timeout, I2C_TIMEOUT_BUSY) + 1 tick) + retries * 0.2 ms
+ *
+ * The bound without the busy wait and the tick, (retries + 1) * i2c_timeout + retries * 0.2 ms, is printed
+ * for comparison : a stuck SDA or a timeout on every attempt exceeds it.
+ * Exit code is 0 when every check passed.
+ */
+
+#include <HDC2022.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_CLOCK_MHZ         80
+#define SIM_BIT_US            10      /*  100 kHz                                                  */
+#define SIM_INIT_US           20      /*  HAL_I2C_Init() or HAL_I2C_DeInit(), generous             */
+#define SIM_RECOVERY_US       200     /*  Bound of one I2C_recover(), see HDC2022.cpp              */
+#define SIM_MAX_FAULTS        4
+
+typedef enum
+{
+  FAULT_NONE = 0,
+  FAULT_NACK,
+  FAULT_TIMEOUT,
+  FAULT_BERR,
+  FAULT_ARLO,
+  FAULT_STUCK,
+}fault_t;
+
+typedef struct
+{
+  const char *name;
+  fault_t faults[SIM_MAX_FAULTS];     /*  Outcome of call 1, 2, .. then FAULT_NONE                  */
+  uint16_t stuck_clocks;              /*  FAULT_STUCK : SCL clocks until SDA is released            */
+  uint8_t pins;                       /*  set_RecoveryPins() called                                 */
+  uint8_t result;                     /*  Expected HDC2022_c::result_t                              */
+  uint8_t retries;
+  uint8_t recoveries;
+  uint8_t scl_edges;                  /*  Rising SCL edges clocked by I2C_recover()                 */
+}scenario_t;
+
+/*  Retries stay at the default 2, the clocks loop of I2C_recover() gives up after 9 + STOP  */
+static const scenario_t scenarios[] =
+{
+  { "clean",                 { FAULT_NONE },                          0,    1, HDC2022_c::RESULT_OK,        0, 0, 0  },
+  { "NACK once",             { FAULT_NACK },                          0,    1, HDC2022_c::RESULT_OK,        1, 0, 0  },
+  { "NACK always",           { FAULT_NACK, FAULT_NACK, FAULT_NACK },  0,    1, HDC2022_c::RESULT_NACK,      2, 0, 0  },
+  { "timeout once",          { FAULT_TIMEOUT },                       0,    1, HDC2022_c::RESULT_OK,        1, 1, 1  },
+  { "timeout always",        { FAULT_TIMEOUT, FAULT_TIMEOUT, FAULT_TIMEOUT }, 0, 1, HDC2022_c::RESULT_TIMEOUT, 2, 2, 2 },
+  { "BERR once",             { FAULT_BERR },                          0,    1, HDC2022_c::RESULT_OK,        1, 1, 1  },
+  { "ARLO once",             { FAULT_ARLO },                          0,    1, HDC2022_c::RESULT_OK,        1, 1, 1  },
+  { "BERR, ARLO, BERR",      { FAULT_BERR, FAULT_ARLO, FAULT_BERR },  0,    1, HDC2022_c::RESULT_BUS_ERROR, 2, 2, 2  },
+  { "stuck SDA, 3 clocks",   { FAULT_STUCK },                         3,    1, HDC2022_c::RESULT_OK,        1, 1, 4  },
+  { "stuck SDA for good",    { FAULT_STUCK },                         1000, 1, HDC2022_c::RESULT_TIMEOUT,   2, 2, 20 },
+  { "NACK, stuck SDA",       { FAULT_NACK, FAULT_STUCK },             2,    1, HDC2022_c::RESULT_OK,        2, 1, 3  },
+  { "stuck SDA, no pins",    { FAULT_STUCK },                         1,    0, HDC2022_c::RESULT_TIMEOUT,   2, 2, 0  },
+};
+
+uint32_t SystemCoreClock = SIM_CLOCK_MHZ * 1000000U;
+GPIO_TypeDef host_gpiob = { 1 };
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+ITM_Type host_itm;
+
+static uint64_t cycles;               /*  Virtual core clock                                        */
+static uint8_t registers[256];
+static const scenario_t *scenario;    /*  NULL = no faults (Init)                                   */
+static uint8_t call;
+static uint16_t sda_held;             /*  SCL clocks until the slave releases SDA                   */
+static GPIO_PinState scl_level = GPIO_PIN_SET;
+static uint32_t scl_edges;
+static uint32_t deinits;
+static uint32_t inits;
+static uint64_t recovery_start;
+static uint32_t worst_recovery_us;
+
+static void advance_us(uint32_t us)
+{
+    cycles += (uint64_t)us * SIM_CLOCK_MHZ;
+}
+
+/*  A spin loop reads the counter once per pass, a few cycles each  */
+uint32_t host_Cycles(void)
+{
+    cycles += 4;
+    return (uint32_t)cycles;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(cycles / (SIM_CLOCK_MHZ * 1000U));
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub)
+{
+    (void)irq; (void)preempt; (void)sub;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init)
+{
+    (void)port; (void)init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    (void)port;
+    if (pin != GPIO_PIN_6)
+    {
+        return;
+    }
+    if ((scl_level == GPIO_PIN_RESET) && (state == GPIO_PIN_SET))
+    {
+        scl_edges++;
+        sda_held = (sda_held != 0) ? (uint16_t)(sda_held - 1) : 0;
+    }
+    scl_level = state;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin)
+{
+    (void)port;
+    return ((pin == GPIO_PIN_7) && (sda_held != 0)) ? GPIO_PIN_RESET : GPIO_PIN_SET;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+    deinits++;
+    recovery_start = cycles;
+    advance_us(SIM_INIT_US);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    uint32_t us;
+
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    inits++;
+    advance_us(SIM_INIT_US);
+    us = (uint32_t)((cycles - recovery_start) / SIM_CLOCK_MHZ);
+    worst_recovery_us = (us > worst_recovery_us) ? us : worst_recovery_us;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t address, uint32_t trials, uint32_t timeout)
+{
+    (void)trials; (void)timeout;
+    advance_us(11 * SIM_BIT_US);
+    hi2c->ErrorCode = (address == (0x40 << 1)) ? HAL_I2C_ERROR_NONE : HAL_I2C_ERROR_AF;
+    return (address == (0x40 << 1)) ? HAL_OK : HAL_ERROR;
+}
+
+/*  One blocking register access : the scripted fault or the transfer, time advanced on the wire model  */
+static HAL_StatusTypeDef mem_Access(I2C_HandleTypeDef *hi2c, uint16_t reg, uint8_t *data, uint16_t size,
+                                    uint32_t timeout, uint8_t write)
+{
+    fault_t fault = FAULT_NONE;
+
+    if ((scenario != NULL) && (call < SIM_MAX_FAULTS))
+    {
+        fault = scenario->faults[call];
+    }
+    call++;
+    if (fault == FAULT_STUCK)
+    {
+        sda_held = scenario->stuck_clocks;
+    }
+
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    if (sda_held != 0)
+    {
+        advance_us((I2C_TIMEOUT_BUSY + 1) * 1000);
+        hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+        return HAL_ERROR;
+    }
+
+    switch (fault)
+    {
+        case FAULT_NACK:
+            advance_us(11 * SIM_BIT_US);
+            hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+            return HAL_ERROR;
+        case FAULT_TIMEOUT:
+            advance_us((timeout + 1) * 1000);
+            hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+            return HAL_ERROR;
+        case FAULT_BERR:
+        case FAULT_ARLO:
+            advance_us(19 * SIM_BIT_US);
+            hi2c->ErrorCode = (fault == FAULT_BERR) ? HAL_I2C_ERROR_BERR : HAL_I2C_ERROR_ARLO;
+            return HAL_ERROR;
+        default:
+            break;
+    }
+
+    /*  START, address, register, (repeated START, address), data, STOP  */
+    advance_us((uint32_t)(2 + 18 + (write ? 0 : 10) + 9 * size) * SIM_BIT_US);
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (write)
+        {
+            registers[(reg + i) & 0xFF] = data[i];
+        }
+        else
+        {
+            data[i] = registers[(reg + i) & 0xFF];
+        }
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                    uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)address; (void)reg_size;
+    return mem_Access(hi2c, reg, data, size, timeout, 1);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                   uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)address; (void)reg_size;
+    return mem_Access(hi2c, reg, data, size, timeout, 0);
+}
+
+/*  The interrupt driven path of I2CBus_c is linked but not attached here  */
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                       uint8_t *data, uint16_t size)
+{
+    (void)hi2c; (void)address; (void)reg; (void)reg_size; (void)data; (void)size;
+    return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint16_t reg, uint16_t reg_size,
+                                      uint8_t *data, uint16_t size)
+{
+    (void)hi2c; (void)address; (void)reg; (void)reg_size; (void)data; (void)size;
+    return HAL_ERROR;
+}
+
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c)
+{
+    return hi2c->ErrorCode;
+}
+
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+static int check(const char *name, const char *what, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("  %s : %s %u, expected %u\n", name, what, value, expected);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t timeout = (argc > 1) ? (uint32_t)atoi(argv[1]) : 10;
+    uint32_t attempt_ms = ((timeout > I2C_TIMEOUT_BUSY) ? timeout : I2C_TIMEOUT_BUSY) + 1;
+    uint32_t bound_us = 3 * attempt_ms * 1000 + 2 * SIM_RECOVERY_US;
+    uint32_t old_bound_us = 3 * timeout * 1000 + 2 * SIM_RECOVERY_US;
+    uint32_t worst_us = 0;
+    int failed = 0;
+
+    static const uint8_t ids[4] = { 0x49, 0x54, 0xD0, 0x07 };
+
+    printf("i2c timeout %u ms, bound %u us, (retries + 1) * timeout + retries * recovery = %u us\n\n",
+           timeout, bound_us, old_bound_us);
+    printf("%-22s %-8s %7s %10s %9s %11s\n", "scenario", "result", "retries", "recoveries", "SCL edges", "latency us");
+
+    for (uint32_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++)
+    {
+        const scenario_t *sc = &scenarios[s];
+        I2C_HandleTypeDef hi2c = {};
+        HDC2022_c sensor;
+        uint32_t retries;
+        uint32_t recoveries;
+        uint32_t latency_us;
+        uint32_t edges;
+        uint64_t start;
+        int bad = 0;
+
+        memset(registers, 0, sizeof(registers));
+        memcpy(&registers[0xFC], ids, sizeof(ids));
+        registers[0x04] = 0x80;
+        scenario = NULL;
+        sda_held = 0;
+        scl_level = GPIO_PIN_SET;
+
+        if (sensor.Init(hi2c, (uint8_t)timeout) != HDC2022_c::RESULT_OK)
+        {
+            printf("%s : Init failed\n", sc->name);
+            failed = 1;
+            continue;
+        }
+        if (sc->pins)
+        {
+            sensor.set_RecoveryPins(GPIOB, GPIO_PIN_6, GPIOB, GPIO_PIN_7);
+        }
+        retries = sensor.get_Statistics().retries;
+        recoveries = sensor.get_Statistics().recoveries;
+        scenario = sc;
+        call = 0;
+        scl_edges = 0;
+        deinits = 0;
+        inits = 0;
+        worst_recovery_us = 0;
+
+        start = cycles;
+        sensor.get_Status();
+        latency_us = (uint32_t)((cycles - start) / SIM_CLOCK_MHZ);
+
+        retries = sensor.get_Statistics().retries - retries;
+        recoveries = sensor.get_Statistics().recoveries - recoveries;
+        edges = scl_edges;
+        worst_us = (latency_us > worst_us) ? latency_us : worst_us;
+        printf("%-22s %-8u %7u %10u %9u %11u\n", sc->name, sensor.get_LastResult(), retries, recoveries, edges, latency_us);
+
+        bad |= check(sc->name, "result", sensor.get_LastResult(), sc->result);
+        bad |= check(sc->name, "retries", retries, sc->retries);
+        bad |= check(sc->name, "recoveries", recoveries, sc->recoveries);
+        bad |= check(sc->name, "HAL_I2C_DeInit", deinits, sc->recoveries);
+        bad |= check(sc->name, "HAL_I2C_Init", inits, sc->recoveries);
+        bad |= check(sc->name, "SCL edges", edges, sc->scl_edges);
+        bad |= check(sc->name, "HAL calls", call, (uint32_t)sc->retries + 1);
+        if (worst_recovery_us > SIM_RECOVERY_US)
+        {
+            printf("  %s : recovery took %u us\n", sc->name, worst_recovery_us);
+            bad = 1;
+        }
+        if ((latency_us > bound_us) || (sensor.get_Statistics().worst_cycles / SIM_CLOCK_MHZ > bound_us))
+        {
+            printf("  %s : latency %u us above the bound\n", sc->name, latency_us);
+            bad = 1;
+        }
+        failed |= bad;
+    }
+
+    printf("\nworst latency %u us, bound %u us\n", worst_us, bound_us);
+    printf("%s\n", failed ? "FAILED" : "passed");
+    return failed;
+}
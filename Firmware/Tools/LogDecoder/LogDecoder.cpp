@@ -0,0 +1,448 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host decoder for the Log_c UART stream, expands deferred and tokenized records from the ELF
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 LogDecoder.cpp -o LogDecoder
+ *
+ * Usage
+ *
+ *	./LogDecoder STM32L476RG_HDC2022.elf capture.bin
+ *	stty -F /dev/ttyACM0 115200 raw && ./LogDecoder STM32L476RG_HDC2022.elf /dev/ttyACM0
+ *
+ * Text is copied as is. A deferred record (0xFE, word count, format address, arguments, little endian)
+ * is formatted with the format string read from the ELF of the same build : %d %i %u %x %X %o %c %p
+ * take one 32 bit word, %f %e %g %a an IEEE single, %s the address of a string in the image,
+ * %T / %H a raw HDC2022 temperature / humidity code, printed as °C / %RH (2 decimals unless a precision is given).
+ * A tokenized record (0xFD / 0xFC, word count, 32 / 16 bit token, arguments) takes its format from the
+ * .log_tokens section, any ELF with the same strings will do. Token collisions are reported at start.
+ *
+ * The summary on stderr compares the bytes received for the records with the text they expand to.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+
+#define LOG_RECORD_MARK       0xFE
+#define LOG_TOKEN32_MARK      0xFD
+#define LOG_TOKEN16_MARK      0xFC
+#define LOG_MAX_WORDS         16
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t size;
+    uint32_t offset;
+} section_t;
+
+static std::vector<uint8_t> image;
+static std::vector<section_t> sections;
+static std::map<uint32_t, std::string> tokens32;
+static std::map<uint32_t, std::string> tokens16;
+
+static uint32_t get_32(const uint8_t *p)
+{
+    return (uint32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static uint16_t get_16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * @brief  FNV-1a Hash
+ * @note   Same as Log_c::hash()
+ * @param  const char *text
+ * @retval uint32_t
+ */
+static uint32_t hash(const char *text)
+{
+    uint32_t value = 2166136261UL;
+
+    while (*text)
+    {
+        value = (value ^ (uint8_t)*text++) * 16777619UL;
+    }
+
+    return value;
+}
+
+/**
+ * @brief  Load Token Table
+ * @note   .log_tokens entries : uint32_t token, uint32_t length (with NUL), text, padded to 4 bytes.
+ * 		Every text is entered with its 32 bit hash token and the 16 bit fold, the firmware uses one of them
+ * @param  const uint8_t *data
+ * @param  uint32_t size
+ * @retval None
+ */
+static void load_Tokens(const uint8_t *data, uint32_t size)
+{
+    uint32_t pos = 0;
+    uint32_t collisions = 0;
+
+    while (pos + 8 <= size)
+    {
+        uint32_t token = get_32(&data[pos]);
+        uint32_t length = get_32(&data[pos + 4]);
+        std::string text;
+
+        if ((length == 0) || (pos + 8 + length > size))
+        {
+            fprintf(stderr, ".log_tokens corrupt at %u\n", (unsigned)pos);
+            break;
+        }
+        text.assign((const char *)&data[pos + 8], length - 1);
+        pos += (8 + length + 3) & ~3UL;
+
+        uint32_t token32 = hash(text.c_str());
+        uint32_t token16 = (token32 ^ (token32 >> 16)) & 0xFFFF;
+        std::map<uint32_t, std::string> &table = (token == token32) ? tokens32 : tokens16;
+        auto found = table.find(token);
+
+        if ((token != token32) && (token != token16))
+        {
+            fprintf(stderr, "token 0x%08X does not match \"%s\"\n", (unsigned)token, text.c_str());
+        }
+        if ((found != table.end()) && (found->second != text))
+        {
+            fprintf(stderr, "token collision 0x%08X : \"%s\" / \"%s\"\n", (unsigned)token, found->second.c_str(), text.c_str());
+            collisions++;
+        }
+        tokens32[token32] = text;
+        tokens16[token16] = text;
+    }
+
+    fprintf(stderr, "%u tokens, %u collisions\n", (unsigned)tokens32.size(), (unsigned)collisions);
+}
+
+/**
+ * @brief  Load ELF Image
+ * @note   32 bit little endian only, keeps every allocated section that has file contents
+ * @param  const char *path
+ * @retval int	:	1 = OK
+ */
+static int load_Elf(const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    long length;
+    uint32_t shoff;
+    uint16_t shentsize;
+    uint16_t shnum;
+    const uint8_t *names;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return 0;
+    }
+    fseek(in, 0, SEEK_END);
+    length = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    image.resize(length);
+    if (fread(image.data(), 1, length, in) != (size_t)length)
+    {
+        fclose(in);
+        return 0;
+    }
+    fclose(in);
+
+    if ((length < 52) || memcmp(image.data(), "\x7F" "ELF", 4) || (image[4] != 1) || (image[5] != 1))
+    {
+        fprintf(stderr, "%s : not a 32 bit little endian ELF\n", path);
+        return 0;
+    }
+
+    shoff = get_32(&image[32]);
+    shentsize = get_16(&image[46]);
+    shnum = get_16(&image[48]);
+    names = &image[get_32(&image[shoff + (uint32_t)get_16(&image[50]) * shentsize + 16])];
+    for (uint16_t i = 0; i < shnum; i++)
+    {
+        const uint8_t *sh = &image[shoff + (uint32_t)i * shentsize];
+        uint32_t type = get_32(sh + 4);
+        uint32_t flags = get_32(sh + 8);
+        section_t section = { get_32(sh + 12), get_32(sh + 20), get_32(sh + 16) };
+
+        if ((type == 8) || (section.size == 0) || (section.offset + section.size > (uint32_t)length))
+        {
+            continue;
+        }
+        if (strcmp((const char *)&names[get_32(sh)], ".log_tokens") == 0)
+        {
+            load_Tokens(&image[section.offset], section.size);
+        }
+        else if (flags & 0x2)
+        {
+            sections.push_back(section);
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief  Find String In Image
+ * @note   NULL when the address is outside the image or the string is not terminated there
+ * @param  uint32_t address
+ * @retval const char *
+ */
+static const char *find_String(uint32_t address)
+{
+    for (const section_t &section : sections)
+    {
+        if ((address >= section.address) && (address < section.address + section.size))
+        {
+            const char *text = (const char *)&image[section.offset + (address - section.address)];
+
+            if (memchr(text, 0, section.address + section.size - address) == NULL)
+            {
+                return NULL;
+            }
+            return text;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief  Format Deferred Record
+ * @note   Conversion by conversion, length modifiers are dropped since every argument is one word
+ * @param  const char *format
+ * @param  const uint32_t *args
+ * @param  uint8_t count	:	Number of argument words
+ * @retval std::string
+ */
+static std::string format_Record(const char *format, const uint32_t *args, uint8_t count)
+{
+    std::string out;
+    char spec[32];
+    char text[512];
+    uint8_t used = 0;
+
+    while (*format)
+    {
+        size_t n = 0;
+        char conversion;
+
+        if (*format != '%')
+        {
+            out += *format++;
+            continue;
+        }
+        if (format[1] == '%')
+        {
+            out += '%';
+            format += 2;
+            continue;
+        }
+
+        spec[n++] = *format++;
+        while (*format && strchr("-+ #0123456789.*", *format) && (n < sizeof(spec) - 3))
+        {
+            if ((*format == '*') && (used < count))
+            {
+                n += snprintf(&spec[n], sizeof(spec) - n, "%d", (int)(int32_t)args[used++]);
+                format++;
+                continue;
+            }
+            spec[n++] = *format++;
+        }
+        while (*format && strchr("hlLqjzt", *format))
+        {
+            format++;
+        }
+        conversion = *format;
+        if (conversion == 0)
+        {
+            break;
+        }
+        format++;
+
+        if (used >= count)
+        {
+            out += "<missing>";
+            continue;
+        }
+        uint32_t word = args[used++];
+
+        spec[n++] = conversion;
+        spec[n] = 0;
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+                snprintf(text, sizeof(text), spec, (int)(int32_t)word);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'c':
+                snprintf(text, sizeof(text), spec, (unsigned int)word);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+            {
+                float value;
+
+                memcpy(&value, &word, 4);
+                snprintf(text, sizeof(text), spec, (double)value);
+                break;
+            }
+            case 's':
+            {
+                const char *string = find_String(word);
+
+                if (string)
+                {
+                    snprintf(text, sizeof(text), spec, string);
+                }
+                else
+                {
+                    snprintf(text, sizeof(text), "<0x%08X>", (unsigned)word);
+                }
+                break;
+            }
+            case 'p':
+                snprintf(text, sizeof(text), "0x%08X", (unsigned)word);
+                break;
+            case 'T':
+            case 'H':
+            {
+                /*  HDC2022 raw codes, converted here instead of on the target  */
+                double value = (conversion == 'T') ? (word & 0xFFFF) * 165.0 / 65536.0 - 40.0
+                                                   : (word & 0xFFFF) * 100.0 / 65536.0;
+
+                spec[n - 1] = 0;
+                snprintf(&spec[n - 1], sizeof(spec) - (n - 1), strchr(spec, '.') ? "f" : ".2f");
+                snprintf(text, sizeof(text), spec, value);
+                break;
+            }
+            default:
+                snprintf(text, sizeof(text), "<%%%c?>", conversion);
+                break;
+        }
+        out += text;
+    }
+
+    return out;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t words[LOG_MAX_WORDS];
+    uint32_t records = 0;
+    uint32_t unknown = 0;
+    unsigned long long wire_bytes = 0;
+    unsigned long long text_bytes = 0;
+    FILE *in;
+    int c;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <firmware.elf> <capture.bin | tty>\n", argv[0]);
+        return 2;
+    }
+    if (!load_Elf(argv[1]))
+    {
+        return 1;
+    }
+    in = fopen(argv[2], "rb");
+    if (in == NULL)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    while ((c = fgetc(in)) != EOF)
+    {
+        int count;
+        int id_bytes = (c == LOG_TOKEN16_MARK) ? 2 : 4;
+        const char *format = NULL;
+        std::string text;
+
+        if ((c != LOG_RECORD_MARK) && (c != LOG_TOKEN32_MARK) && (c != LOG_TOKEN16_MARK))
+        {
+            putchar(c);
+            continue;
+        }
+
+        count = fgetc(in);
+        if ((count <= 0) || (count > LOG_MAX_WORDS))
+        {
+            fprintf(stderr, "bad record length %d\n", count);
+            continue;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            uint8_t bytes[4] = {};
+            size_t size = (i == 0) ? id_bytes : 4;
+
+            if (fread(bytes, 1, size, in) != size)
+            {
+                fprintf(stderr, "record truncated\n");
+                return 1;
+            }
+            words[i] = get_32(bytes);
+        }
+
+        if (c == LOG_RECORD_MARK)
+        {
+            format = find_String(words[0]);
+        }
+        else
+        {
+            std::map<uint32_t, std::string> &table = (c == LOG_TOKEN16_MARK) ? tokens16 : tokens32;
+            auto found = table.find(words[0]);
+
+            if (found != table.end())
+            {
+                format = found->second.c_str();
+            }
+        }
+        if (format == NULL)
+        {
+            printf("<unknown %s 0x%08X>\n", (c == LOG_RECORD_MARK) ? "format" : "token", (unsigned)words[0]);
+            unknown++;
+            continue;
+        }
+        text = format_Record(format, &words[1], (uint8_t)(count - 1));
+        fputs(text.c_str(), stdout);
+        records++;
+        wire_bytes += 2 + id_bytes + 4 * (count - 1);
+        text_bytes += text.size();
+    }
+
+    fclose(in);
+    fprintf(stderr, "%u records, %u unknown\n", (unsigned)records, (unsigned)unknown);
+    if (records)
+    {
+        fprintf(stderr, "records %llu bytes, as text %llu bytes, %.1f bytes saved per call\n", wire_bytes,
+                text_bytes, (double)((long long)text_bytes - (long long)wire_bytes) / records);
+    }
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host benchmark of Pool_c / Arena_c against malloc / free
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -I../../STM32CubeIDE/Core/Inc PoolBench.cpp -o PoolBench
+ *
+ * Usage
+ *
+ *	./PoolBench [rounds]
+ *
+ * Three patterns on 32 byte objects (the size of an i2c_txn_t on the target) with up to 16 live objects :
+ * LIFO (alloc then free in reverse), FIFO churn (free the oldest, allocate a new one) and scratch
+ * (16 blocks of mixed size, then all released). Each pattern runs with Pool_c / Arena_c and with
+ * malloc / free, the results are checked by writing and reading every block. Times are ns per
+ * alloc + free pair. The host has no interrupt masking, the target adds about 4 cycles per call for it.
+ */
+
+#include <Pool.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_LIVE            16
+
+typedef struct
+{
+    uint8_t bytes[32];
+} object_t;
+
+static Pool_c<object_t, BENCH_LIVE> pool;
+static Arena_c<BENCH_LIVE * 64> arena;
+static volatile uint32_t sink;
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void touch(void *block, uint32_t size, uint32_t value)
+{
+    if (block == NULL)
+    {
+        fprintf(stderr, "allocation failed\n");
+        exit(1);
+    }
+    memset(block, (int)(value & 0xFF), size);
+    sink += ((uint8_t *)block)[size - 1];
+}
+
+static double lifo_Pool(uint32_t rounds)
+{
+    object_t *live[BENCH_LIVE];
+    double start = now_ns();
+
+    for (uint32_t r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < BENCH_LIVE; i++)
+        {
+            live[i] = pool.alloc();
+            touch(live[i], sizeof(object_t), r);
+        }
+        for (int i = BENCH_LIVE - 1; i >= 0; i--)
+        {
+            pool.free(live[i]);
+        }
+    }
+    return (now_ns() - start) / ((double)rounds * BENCH_LIVE);
+}
+
+static double lifo_Malloc(uint32_t rounds)
+{
+    void *live[BENCH_LIVE];
+    double start = now_ns();
+
+    for (uint32_t r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < BENCH_LIVE; i++)
+        {
+            live[i] = malloc(sizeof(object_t));
+            touch(live[i], sizeof(object_t), r);
+        }
+        for (int i = BENCH_LIVE - 1; i >= 0; i--)
+        {
+            free(live[i]);
+        }
+    }
+    return (now_ns() - start) / ((double)rounds * BENCH_LIVE);
+}
+
+static double fifo_Pool(uint32_t rounds)
+{
+    object_t *live[BENCH_LIVE];
+    uint32_t steps = rounds * BENCH_LIVE;
+    double start;
+
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        live[i] = pool.alloc();
+    }
+    start = now_ns();
+    for (uint32_t s = 0; s < steps; s++)
+    {
+        pool.free(live[s % BENCH_LIVE]);
+        live[s % BENCH_LIVE] = pool.alloc();
+        touch(live[s % BENCH_LIVE], sizeof(object_t), s);
+    }
+    start = (now_ns() - start) / steps;
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        pool.free(live[i]);
+    }
+    return start;
+}
+
+static double fifo_Malloc(uint32_t rounds)
+{
+    void *live[BENCH_LIVE];
+    uint32_t steps = rounds * BENCH_LIVE;
+    double start;
+
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        live[i] = malloc(sizeof(object_t));
+    }
+    start = now_ns();
+    for (uint32_t s = 0; s < steps; s++)
+    {
+        free(live[s % BENCH_LIVE]);
+        live[s % BENCH_LIVE] = malloc(sizeof(object_t));
+        touch(live[s % BENCH_LIVE], sizeof(object_t), s);
+    }
+    start = (now_ns() - start) / steps;
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        free(live[i]);
+    }
+    return start;
+}
+
+static double scratch_Arena(uint32_t rounds)
+{
+    double start = now_ns();
+
+    for (uint32_t r = 0; r < rounds; r++)
+    {
+        for (uint32_t i = 0; i < BENCH_LIVE; i++)
+        {
+            uint32_t size = 8 + ((i * 13) & 31);
+
+            touch(arena.alloc(size), size, r);
+        }
+        arena.reset();
+    }
+    return (now_ns() - start) / ((double)rounds * BENCH_LIVE);
+}
+
+static double scratch_Malloc(uint32_t rounds)
+{
+    void *live[BENCH_LIVE];
+    double start = now_ns();
+
+    for (uint32_t r = 0; r < rounds; r++)
+    {
+        for (uint32_t i = 0; i < BENCH_LIVE; i++)
+        {
+            uint32_t size = 8 + ((i * 13) & 31);
+
+            live[i] = malloc(size);
+            touch(live[i], size, r);
+        }
+        for (uint32_t i = 0; i < BENCH_LIVE; i++)
+        {
+            free(live[i]);
+        }
+    }
+    return (now_ns() - start) / ((double)rounds * BENCH_LIVE);
+}
+
+/**
+ * @brief  Check Pool Behaviour
+ * @note   Exhaustion, foreign, misaligned, never handed out and double freed pointers, reuse and arena rewind
+ * @param  None
+ * @retval int	:	0 = pass
+ */
+static int check()
+{
+    static Pool_c<object_t, 4> small;
+    object_t *live[BENCH_LIVE];
+    object_t *first;
+    object_t outside;
+    uint32_t mark;
+    int failed = 0;
+
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        live[i] = pool.alloc();
+        failed |= (live[i] == NULL);
+    }
+    failed |= (pool.alloc() != NULL) || (pool.get_Statistics().failures != 1) || (pool.get_Free() != 0);
+    pool.free(&outside);
+    pool.free((object_t *)((uint8_t *)live[0] + 1));
+    failed |= (pool.get_Statistics().invalid != 2);
+    pool.free(live[3]);
+    pool.free(live[3]);
+    failed |= (pool.get_Statistics().invalid != 3) || (pool.get_Free() != 1);
+    failed |= (pool.alloc() != live[3]) || (pool.alloc() != NULL);
+    for (int i = 0; i < BENCH_LIVE; i++)
+    {
+        pool.free(live[i]);
+    }
+    failed |= (pool.get_Free() != BENCH_LIVE) || (pool.get_Statistics().worst_in_use != BENCH_LIVE);
+
+    /*  A slot past the ones handed out is not on the free list, a free() of it must not put it there  */
+    first = small.alloc();
+    small.free(first + 1);
+    failed |= (small.get_Statistics().invalid != 1) || (small.get_Free() != 3);
+    small.free(first);
+    small.free(first);
+    failed |= (small.get_Statistics().invalid != 2);
+    for (int i = 0; i < 4; i++)
+    {
+        live[i] = small.alloc();
+        for (int j = 0; j < i; j++)
+        {
+            failed |= (live[i] == live[j]);
+        }
+    }
+    failed |= (live[3] == NULL) || (small.alloc() != NULL);
+
+    mark = arena.get_Mark();
+    failed |= (((uintptr_t)arena.alloc(3) & 7) != 0) || (((uintptr_t)arena.alloc(5) & 7) != 0);
+    failed |= (arena.alloc(BENCH_LIVE * 64) != NULL);
+    arena.rewind(mark);
+    failed |= (arena.get_Free() != BENCH_LIVE * 64);
+
+    fprintf(stderr, "checks %s\n", failed ? "FAILED" : "passed");
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t rounds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1000000;
+
+    if (check())
+    {
+        return 1;
+    }
+
+    printf("pattern            Pool_c/Arena_c      malloc/free   (ns per alloc + free)\n");
+    printf("LIFO               %14.2f %16.2f\n", lifo_Pool(rounds), lifo_Malloc(rounds));
+    printf("FIFO churn         %14.2f %16.2f\n", fifo_Pool(rounds), fifo_Malloc(rounds));
+    printf("scratch / reset    %14.2f %16.2f\n", scratch_Arena(rounds), scratch_Malloc(rounds));
+    return 0;
+}
@@ -0,0 +1,282 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host check of HDC2022Map against the datasheet register tables
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -std=gnu++14 -O2 -I../../STM32CubeIDE/Core/Inc RegisterMapCheck.cpp -o RegisterMapCheck
+ *
+ * Usage
+ *
+ *	./RegisterMapCheck
+ *
+ * The datasheet tables (HDC2022 SNAS812, section 7.6 Register Maps) are typed in below independently of
+ * HDC2022Regs.hpp : address, access and reset value of every register and the bit range of every field.
+ * Each register and field of the map is compared with its row, the fields of a register must not overlap,
+ * and masked writes are checked against a plain read-modify-write of every field. The static_asserts at
+ * the end fail the build when a field access does not fold to a constant. Exit status 0 = pass.
+ */
+
+#include <HDC2022Regs.hpp>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    uint8_t address;
+    uint8_t access;
+    uint8_t reset;
+} datasheet_register_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t address;
+    uint8_t msb;
+    uint8_t lsb;
+} datasheet_field_t;
+
+static const datasheet_register_t datasheet_registers[] =
+{
+    { "TEMPERATURE_LOW",           0x00, HDC_R,  0x00 },
+    { "TEMPERATURE_HIGH",          0x01, HDC_R,  0x00 },
+    { "HUMIDITY_LOW",              0x02, HDC_R,  0x00 },
+    { "HUMIDITY_HIGH",             0x03, HDC_R,  0x00 },
+    { "STATUS",                    0x04, HDC_R,  0x00 },
+    { "TEMPERATURE_MAX",           0x05, HDC_R,  0x00 },
+    { "HUMIDITY_MAX",              0x06, HDC_R,  0x00 },
+    { "INTERRUPT_ENABLE",          0x07, HDC_RW, 0x00 },
+    { "TEMP_OFFSET_ADJUST",        0x08, HDC_RW, 0x00 },
+    { "HUM_OFFSET_ADJUST",         0x09, HDC_RW, 0x00 },
+    { "TEMP_THR_L",                0x0A, HDC_RW, 0x01 },
+    { "TEMP_THR_H",                0x0B, HDC_RW, 0xFF },
+    { "RH_THR_L",                  0x0C, HDC_RW, 0x00 },
+    { "RH_THR_H",                  0x0D, HDC_RW, 0xFF },
+    { "DEVICE_CONFIGURATION",      0x0E, HDC_RW, 0x00 },
+    { "MEASUREMENT_CONFIGURATION", 0x0F, HDC_RW, 0x00 },
+    { "MANUFACTURER_ID_LOW",       0xFC, HDC_R,  0x49 },
+    { "MANUFACTURER_ID_HIGH",      0xFD, HDC_R,  0x54 },
+    { "DEVICE_ID_LOW",             0xFE, HDC_R,  0xD0 },
+    { "DEVICE_ID_HIGH",            0xFF, HDC_R,  0x07 },
+};
+
+static const datasheet_field_t datasheet_fields[] =
+{
+    { "DRDY_STATUS", 0x04, 7, 7 },
+    { "TH_STATUS",   0x04, 6, 6 },
+    { "TL_STATUS",   0x04, 5, 5 },
+    { "HH_STATUS",   0x04, 4, 4 },
+    { "HL_STATUS",   0x04, 3, 3 },
+    { "DRDY_ENABLE", 0x07, 7, 7 },
+    { "TH_ENABLE",   0x07, 6, 6 },
+    { "TL_ENABLE",   0x07, 5, 5 },
+    { "HH_ENABLE",   0x07, 4, 4 },
+    { "HL_ENABLE",   0x07, 3, 3 },
+    { "SOFT_RES",    0x0E, 7, 7 },
+    { "CC",          0x0E, 6, 4 },
+    { "HEAT_EN",     0x0E, 3, 3 },
+    { "DRDY_INT_EN", 0x0E, 2, 2 },
+    { "INT_POL",     0x0E, 1, 1 },
+    { "INT_MODE",    0x0E, 0, 0 },
+    { "TACC",        0x0F, 7, 6 },
+    { "HACC",        0x0F, 5, 4 },
+    { "MEAS_CONF",   0x0F, 2, 1 },
+    { "MEAS_TRIG",   0x0F, 0, 0 },
+};
+
+static int failed;
+static uint8_t field_masks[256];
+
+static const datasheet_register_t *find_Register(const char *name)
+{
+    for (const datasheet_register_t &row : datasheet_registers)
+    {
+        if (strcmp(row.name, name) == 0)
+        {
+            return &row;
+        }
+    }
+    return NULL;
+}
+
+static const datasheet_field_t *find_Field(const char *name)
+{
+    for (const datasheet_field_t &row : datasheet_fields)
+    {
+        if (strcmp(row.name, name) == 0)
+        {
+            return &row;
+        }
+    }
+    return NULL;
+}
+
+template<typename REGISTER>
+static void check_Register(const char *name)
+{
+    const datasheet_register_t *row = find_Register(name);
+
+    if ((row == NULL) || (row->address != REGISTER::address) || (row->access != REGISTER::access) ||
+        (row->reset != REGISTER::reset))
+    {
+        fprintf(stderr, "register %-26s differs from the datasheet\n", name);
+        failed = 1;
+    }
+}
+
+/**
+ * @brief  Check One Field
+ * @note   Position against the datasheet, overlap with the fields seen before, get() / set() / value()
+ * 		against plain shifts for every register and field value
+ * @param  const char *name	:	Datasheet field name
+ * @retval None
+ */
+template<typename FIELD>
+static void check_Field(const char *name)
+{
+    const datasheet_field_t *row = find_Field(name);
+    uint8_t mask;
+
+    if ((row == NULL) || (row->address != FIELD::address) || (row->lsb != FIELD::shift) ||
+        (row->msb != FIELD::shift + FIELD::width - 1))
+    {
+        fprintf(stderr, "field %-12s differs from the datasheet\n", name);
+        failed = 1;
+        return;
+    }
+
+    mask = (uint8_t)(((1U << (row->msb - row->lsb + 1)) - 1U) << row->lsb);
+    if ((mask != FIELD::mask) || (field_masks[row->address] & mask))
+    {
+        fprintf(stderr, "field %-12s mask 0x%02X overlaps or differs\n", name, FIELD::mask);
+        failed = 1;
+    }
+    field_masks[row->address] |= mask;
+
+    for (uint32_t reg = 0; reg < 256; reg++)
+    {
+        for (uint32_t value = 0; value < (1U << FIELD::width); value++)
+        {
+            uint8_t expected = (uint8_t)((reg & ~mask) | (value << row->lsb));
+
+            if ((FIELD::get((uint8_t)reg) != ((reg & mask) >> row->lsb)) ||
+                (FIELD::set((uint8_t)reg, (uint8_t)value) != expected))
+            {
+                fprintf(stderr, "field %-12s get/set wrong for 0x%02X / %u\n", name, reg, value);
+                failed = 1;
+                return;
+            }
+        }
+    }
+}
+
+#define CHECK_REGISTER(REG)             check_Register<HDC2022Map::REG>(#REG)
+#define CHECK_FIELD(REG, FIELD)         check_Field<HDC2022Map::REG::FIELD>(#FIELD)
+
+/**
+ * @brief  Check Combined Writes
+ * @note   A | B | C of one register equals B, C and A applied one after the other, the later value wins
+ * @param  None
+ * @retval None
+ */
+static void check_Combined()
+{
+    typedef HDC2022Map::DEVICE_CONFIGURATION DEVCFG;
+    typedef HDC2022Map::INTERRUPT_ENABLE INTEN;
+
+    for (uint32_t reg = 0; reg < 256; reg++)
+    {
+        for (uint8_t rate = 0; rate < 8; rate++)
+        {
+            auto fields = DEVCFG::CC::value(rate) | DEVCFG::INT_POL::value(rate & 1) |
+                          DEVCFG::INT_MODE::value(rate >> 1) | DEVCFG::DRDY_INT_EN::value(1);
+            uint8_t expected = DEVCFG::DRDY_INT_EN::set(DEVCFG::INT_MODE::set(DEVCFG::INT_POL::set(
+                               DEVCFG::CC::set((uint8_t)reg, rate), rate & 1), rate >> 1), 1);
+
+            if ((fields.mask != 0x77) || (fields.apply((uint8_t)reg) != expected))
+            {
+                fprintf(stderr, "combined DEVICE_CONFIGURATION write wrong for 0x%02X\n", reg);
+                failed = 1;
+                return;
+            }
+        }
+        if ((INTEN::TL_ENABLE::value(1) | INTEN::TL_ENABLE::value(0)).apply((uint8_t)reg) !=
+            (uint8_t)(reg & ~INTEN::TL_ENABLE::mask))
+        {
+            fprintf(stderr, "combined write does not keep the last value for 0x%02X\n", reg);
+            failed = 1;
+            return;
+        }
+    }
+}
+
+int main()
+{
+    CHECK_REGISTER(TEMPERATURE_LOW);
+    CHECK_REGISTER(TEMPERATURE_HIGH);
+    CHECK_REGISTER(HUMIDITY_LOW);
+    CHECK_REGISTER(HUMIDITY_HIGH);
+    CHECK_REGISTER(STATUS);
+    CHECK_REGISTER(TEMPERATURE_MAX);
+    CHECK_REGISTER(HUMIDITY_MAX);
+    CHECK_REGISTER(INTERRUPT_ENABLE);
+    CHECK_REGISTER(TEMP_OFFSET_ADJUST);
+    CHECK_REGISTER(HUM_OFFSET_ADJUST);
+    CHECK_REGISTER(TEMP_THR_L);
+    CHECK_REGISTER(TEMP_THR_H);
+    CHECK_REGISTER(RH_THR_L);
+    CHECK_REGISTER(RH_THR_H);
+    CHECK_REGISTER(DEVICE_CONFIGURATION);
+    CHECK_REGISTER(MEASUREMENT_CONFIGURATION);
+    CHECK_REGISTER(MANUFACTURER_ID_LOW);
+    CHECK_REGISTER(MANUFACTURER_ID_HIGH);
+    CHECK_REGISTER(DEVICE_ID_LOW);
+    CHECK_REGISTER(DEVICE_ID_HIGH);
+
+    CHECK_FIELD(STATUS, DRDY_STATUS);
+    CHECK_FIELD(STATUS, TH_STATUS);
+    CHECK_FIELD(STATUS, TL_STATUS);
+    CHECK_FIELD(STATUS, HH_STATUS);
+    CHECK_FIELD(STATUS, HL_STATUS);
+    CHECK_FIELD(INTERRUPT_ENABLE, DRDY_ENABLE);
+    CHECK_FIELD(INTERRUPT_ENABLE, TH_ENABLE);
+    CHECK_FIELD(INTERRUPT_ENABLE, TL_ENABLE);
+    CHECK_FIELD(INTERRUPT_ENABLE, HH_ENABLE);
+    CHECK_FIELD(INTERRUPT_ENABLE, HL_ENABLE);
+    CHECK_FIELD(DEVICE_CONFIGURATION, SOFT_RES);
+    CHECK_FIELD(DEVICE_CONFIGURATION, CC);
+    CHECK_FIELD(DEVICE_CONFIGURATION, HEAT_EN);
+    CHECK_FIELD(DEVICE_CONFIGURATION, DRDY_INT_EN);
+    CHECK_FIELD(DEVICE_CONFIGURATION, INT_POL);
+    CHECK_FIELD(DEVICE_CONFIGURATION, INT_MODE);
+    CHECK_FIELD(MEASUREMENT_CONFIGURATION, TACC);
+    CHECK_FIELD(MEASUREMENT_CONFIGURATION, HACC);
+    CHECK_FIELD(MEASUREMENT_CONFIGURATION, MEAS_CONF);
+    CHECK_FIELD(MEASUREMENT_CONFIGURATION, MEAS_TRIG);
+
+    check_Combined();
+
+    fprintf(stderr, "%u registers, %u fields : checks %s\n", (unsigned)(sizeof(datasheet_registers) / sizeof(datasheet_registers[0])),
+            (unsigned)(sizeof(datasheet_fields) / sizeof(datasheet_fields[0])), failed ? "FAILED" : "passed");
+    return failed;
+}
+
+/*  Compile-time folding : none of these may need code at run time */
+static_assert(HDC2022Map::STATUS::DRDY_STATUS::get(0x80) == 1, "get() folds to a shift");
+static_assert(HDC2022Map::DEVICE_CONFIGURATION::CC::get(0x50) == 5, "get() folds to a mask and a shift");
+static_assert((HDC2022Map::DEVICE_CONFIGURATION::CC::value(5) | HDC2022Map::DEVICE_CONFIGURATION::DRDY_INT_EN::value(1)).mask == 0x74,
+              "combined write folds to one mask");
+static_assert((HDC2022Map::DEVICE_CONFIGURATION::CC::value(5) | HDC2022Map::DEVICE_CONFIGURATION::DRDY_INT_EN::value(1)).apply(0x8B) == 0xDF,
+              "combined write folds to one value");
+static_assert(HDC2022Map::MEASUREMENT_CONFIGURATION::MEAS_TRIG::set(0x50, 1) == 0x51, "set() folds");
@@ -0,0 +1,207 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        RtcClock_c calendar arithmetic against the C library over 2000..2099
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -I../HostHal -I../../STM32CubeIDE/Core/Inc RtcCalendarCheck.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/RtcClock.cpp -o RtcCalendarCheck
+ *
+ * Usage
+ *
+ *	./RtcCalendarCheck
+ *
+ * RtcClock.cpp runs unchanged against the register images of Tools/HostHal. The reference is gmtime() and
+ * strftime() of the C library, the RTC register values are built here from their fields. Checked :
+ *
+ *	days        every day 2000-01-01 .. 2099-12-31 : civil_FromDays() and days_FromCivil() against gmtime()
+ *	date        decode_Date() of the BCD RTC_DR of every day, weekday field included
+ *	time        decode_Time() of the BCD RTC_TR of every second of a day
+ *	set_Time    every day at 00:00:00, 23:59:59 and a pseudo-random second : RTC_DR and RTC_TR as written
+ *	            (weekday 1 = Monday) and get_Timestamp() / get_Milliseconds() read back, out of range refused
+ *	build time  parse_BuildTime() of __DATE__ / __TIME__ style strings from strftime("%b %e %Y", "%T")
+ *	seed        Init() seeds a calendar that was never set (INITS clear) and keeps a running one
+ *
+ * Exit code is 0 when every check passed.
+ */
+
+#include <RtcClock.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define SECONDS_2000          946684800U      /*  2000-01-01 00:00:00 UTC                          */
+#define SECONDS_2100          4102444800U     /*  2100-01-01 00:00:00 UTC                          */
+
+RTC_TypeDef host_rtc;
+RCC_TypeDef host_rcc;
+
+void HAL_PWR_EnableBkUpAccess(void)
+{
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return 0;
+}
+
+static uint32_t bcd(uint32_t value)
+{
+    return ((value / 10) << 4) | (value % 10);
+}
+
+static uint32_t make_DR(const struct tm *tm)
+{
+    uint32_t weekday = (tm->tm_wday == 0) ? 7 : tm->tm_wday;
+
+    return (bcd(tm->tm_year - 100) << RTC_DR_YU_Pos) | (weekday << RTC_DR_WDU_Pos)
+        | (bcd(tm->tm_mon + 1) << RTC_DR_MU_Pos) | (bcd(tm->tm_mday) << RTC_DR_DU_Pos);
+}
+
+static uint32_t make_TR(const struct tm *tm)
+{
+    return (bcd(tm->tm_hour) << RTC_TR_HU_Pos) | (bcd(tm->tm_min) << RTC_TR_MNU_Pos) | (bcd(tm->tm_sec) << RTC_TR_SU_Pos);
+}
+
+static int report(const char *name, uint32_t checked, uint32_t failed)
+{
+    printf("%-12s %8u checked  %u failed\n", name, checked, failed);
+    return failed != 0;
+}
+
+int main()
+{
+    RtcClock_c rtc;
+    uint32_t first = SECONDS_2000 / 86400U;
+    uint32_t last = SECONDS_2100 / 86400U - 1;
+    uint32_t seed = 2026;
+    uint32_t checked, failed;
+    int result = 0;
+
+    host_rtc.ISR = RTC_ISR_INITF;               /*  No calendar runs, INITF follows INIT at once  */
+
+    /*  days  */
+    checked = failed = 0;
+    for (uint32_t days = first; days <= last; days++)
+    {
+        time_t t = (time_t)days * 86400;
+        struct tm tm;
+        uint32_t year, month, day;
+
+        gmtime_r(&t, &tm);
+        RtcClock_c::civil_FromDays(days, &year, &month, &day);
+        failed += (year != (uint32_t)tm.tm_year + 1900) || (month != (uint32_t)tm.tm_mon + 1) || (day != (uint32_t)tm.tm_mday);
+        failed += RtcClock_c::days_FromCivil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) != days;
+        checked++;
+    }
+    result |= report("days", checked, failed);
+
+    /*  date  */
+    checked = failed = 0;
+    for (uint32_t days = first; days <= last; days++)
+    {
+        time_t t = (time_t)days * 86400;
+        struct tm tm;
+
+        gmtime_r(&t, &tm);
+        failed += RtcClock_c::decode_Date(make_DR(&tm)) != days * 86400U;
+        checked++;
+    }
+    result |= report("date", checked, failed);
+
+    /*  time  */
+    checked = failed = 0;
+    for (uint32_t sod = 0; sod < 86400U; sod++)
+    {
+        time_t t = SECONDS_2000 + sod;
+        struct tm tm;
+
+        gmtime_r(&t, &tm);
+        failed += RtcClock_c::decode_Time(make_TR(&tm)) != sod;
+        checked++;
+    }
+    result |= report("time", checked, failed);
+
+    /*  set_Time  */
+    checked = failed = 0;
+    for (uint32_t days = first; days <= last; days++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        uint32_t sods[3] = {0, 86399U, (seed >> 8) % 86400U};
+
+        for (int i = 0; i < 3; i++)
+        {
+            uint32_t unix_seconds = days * 86400U + sods[i];
+            time_t t = unix_seconds;
+            struct tm tm;
+            RtcClock_c::rtc_stamp_t stamp;
+
+            gmtime_r(&t, &tm);
+            failed += rtc.set_Time(unix_seconds) != 1;
+            failed += (host_rtc.DR != make_DR(&tm)) || (host_rtc.TR != make_TR(&tm));
+
+            host_rtc.SSR = RTC_PREDIV_S - (seed & 0xFF);
+            stamp = rtc.get_Timestamp();
+            failed += (stamp.seconds != unix_seconds) || (stamp.subseconds != (seed & 0xFF));
+            failed += rtc.get_Milliseconds() != (uint64_t)unix_seconds * 1000U + (seed & 0xFF) * 1000U / 256U;
+            checked++;
+        }
+    }
+    failed += rtc.set_Time(SECONDS_2000 - 1) != 0;
+    failed += rtc.set_Time(SECONDS_2100) != 0;
+    checked += 2;
+    result |= report("set_Time", checked, failed);
+
+    /*  build time  */
+    checked = failed = 0;
+    for (uint32_t days = first; days <= last; days++)
+    {
+        char date[16];
+        char clock[16];
+        time_t t;
+        struct tm tm;
+
+        seed = seed * 1103515245u + 12345u;
+        t = (time_t)days * 86400 + (seed >> 8) % 86400U;
+        gmtime_r(&t, &tm);
+        strftime(date, sizeof(date), "%b %e %Y", &tm);
+        strftime(clock, sizeof(clock), "%H:%M:%S", &tm);
+        failed += RtcClock_c::parse_BuildTime(date, clock) != (uint32_t)t;
+        checked++;
+    }
+    result |= report("build time", checked, failed);
+    printf("             this build %s %s = %u\n", __DATE__, __TIME__, RtcClock_c::parse_BuildTime(__DATE__, __TIME__));
+
+    /*  seed  */
+    checked = failed = 0;
+    host_rcc.BDCR = 0;
+    host_rtc.ISR = RTC_ISR_INITF;
+    host_rtc.TR = 0;
+    host_rtc.DR = 0;
+    host_rtc.SSR = RTC_PREDIV_S;
+    failed += rtc.Init(1792368000U) != 1;
+    failed += rtc.get_Timestamp().seconds != 1792368000U;
+    host_rtc.ISR |= RTC_ISR_INITS;              /*  Year field is not 0 any more  */
+    failed += rtc.Init(SECONDS_2000 + 86400U) != 1;
+    failed += rtc.get_Timestamp().seconds != 1792368000U;
+    host_rtc.ISR = RTC_ISR_INITF;
+    host_rtc.TR = 0;
+    host_rtc.DR = 0;
+    failed += rtc.Init(0) != 1;
+    failed += (host_rtc.TR != 0) || (host_rtc.DR != 0);     /*  No seed, left as reset  */
+    checked = 3;
+    result |= report("seed", checked, failed);
+
+    printf("%s\n", result ? "FAILED" : "passed");
+    return result;
+}
@@ -0,0 +1,224 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host decoder for SampleCodec blocks, prints CSV (timestamp, codes, °C, %RH)
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -I../../STM32CubeIDE/Core/Inc SampleDecoder.cpp ../../STM32CubeIDE/Core/Src/SampleCodec.cpp -o SampleDecoder
+ *
+ * Usage
+ *
+ *	./SampleDecoder capture.bin > samples.csv
+ *	./SampleDecoder --bench [samples]
+ *
+ * Input is a sequence of frames : uint16_t block length (little endian) followed by one encoded block,
+ * the same framing is used for UART dumps and flash log pages.
+ *
+ * --bench encodes synthetic 14 bit codes (shift 2, slow drift plus noise) into 2 KB blocks, decodes them
+ * back and checks the round trip. Two streams : every sample at 1 Hz, and one sample every 60 +- 3 s as
+ * left by the Deadband_c heartbeat. Prints bytes per sample against 8 bytes raw and the encode / decode
+ * rate (best of 5). Exit code is 0 when both streams decode to the input.
+ */
+
+#include <SampleCodec.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define BENCH_BLOCK           2048
+#define BENCH_SHIFT           2
+#define BENCH_RUNS            5
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*  Encodes count samples into length-prefixed blocks, returns the bytes used  */
+static uint32_t encode_All(const codec_sample_t *samples, uint32_t count, uint8_t *out)
+{
+    SampleEncoder_c encoder;
+    uint32_t frame = 0;
+    uint32_t pos = 2;
+
+    encoder.Init(BENCH_SHIFT);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint16_t used = encoder.encode(&samples[i], &out[pos], (uint16_t)(BENCH_BLOCK - (pos - frame - 2)));
+
+        if (used == 0)
+        {
+            out[frame] = (uint8_t)(pos - frame - 2);
+            out[frame + 1] = (uint8_t)((pos - frame - 2) >> 8);
+            frame = pos;
+            pos += 2;
+            encoder.Reset();
+            used = encoder.encode(&samples[i], &out[pos], BENCH_BLOCK);
+        }
+        pos += used;
+    }
+    out[frame] = (uint8_t)(pos - frame - 2);
+    out[frame + 1] = (uint8_t)((pos - frame - 2) >> 8);
+    return pos;
+}
+
+/*  Decodes the blocks of encode_All(), returns the samples that match the input  */
+static uint32_t decode_All(const uint8_t *in, uint32_t size, const codec_sample_t *expected, uint32_t count)
+{
+    SampleDecoder_c decoder;
+    codec_sample_t sample;
+    uint32_t frame = 0;
+    uint32_t matched = 0;
+    uint32_t n = 0;
+
+    while (frame + 2 <= size)
+    {
+        uint16_t length = (uint16_t)(in[frame] | (in[frame + 1] << 8));
+        uint16_t pos = 0;
+        uint16_t used;
+
+        decoder.Reset();
+        while ((pos < length) && decoder.decode(&in[frame + 2 + pos], length - pos, &used, &sample))
+        {
+            matched += (n < count) && (sample.timestamp == expected[n].timestamp)
+                       && (sample.temperature == expected[n].temperature) && (sample.humidity == expected[n].humidity);
+            n++;
+            pos += used;
+        }
+        frame += 2 + length;
+    }
+    return (n == count) ? matched : 0;
+}
+
+static int bench_Stream(const char *name, const codec_sample_t *samples, uint32_t count, uint8_t *buffer)
+{
+    double encode_ns = 1e30;
+    double decode_ns = 1e30;
+    uint32_t bytes = 0;
+    uint32_t matched = 0;
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        double start = now_ns();
+
+        bytes = encode_All(samples, count, buffer);
+        double middle = now_ns();
+        matched = decode_All(buffer, bytes, samples, count);
+        double end = now_ns();
+
+        encode_ns = (middle - start < encode_ns) ? middle - start : encode_ns;
+        decode_ns = (end - middle < decode_ns) ? end - middle : decode_ns;
+    }
+
+    printf("%-10s %8u samples  %5.2f B/sample (%.1fx)  encode %5.1f Msample/s  decode %5.1f Msample/s  %s\n",
+           name, count, (double)bytes / count, 8.0 * count / bytes, count / encode_ns * 1e3, count / decode_ns * 1e3,
+           (matched == count) ? "lossless" : "MISMATCH");
+    return matched != count;
+}
+
+static int bench(uint32_t count)
+{
+    codec_sample_t *dense = (codec_sample_t *)malloc(count * sizeof(codec_sample_t));
+    codec_sample_t *sparse = (codec_sample_t *)malloc((count / 60 + 1) * sizeof(codec_sample_t));
+    uint8_t *buffer = (uint8_t *)malloc(count * 8 + BENCH_BLOCK);
+    uint32_t seed = 29;
+    uint32_t sparse_count = 0;
+    uint32_t next = 0;
+    int failed;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        double t = 25.0 + 2.0 * sin(i / 7200.0) + ((seed = seed * 1103515245u + 12345u) >> 16) % 5 * 0.004;
+        double rh = 45.0 + 5.0 * sin(i / 11000.0) + ((seed = seed * 1103515245u + 12345u) >> 16) % 5 * 0.006;
+
+        dense[i].timestamp = i * 1000;
+        dense[i].temperature = (uint16_t)((uint16_t)((t + 40.0) * 65536.0 / 165.0) & ~((1 << BENCH_SHIFT) - 1));
+        dense[i].humidity = (uint16_t)((uint16_t)(rh * 65536.0 / 100.0) & ~((1 << BENCH_SHIFT) - 1));
+        if (i == next)
+        {
+            sparse[sparse_count++] = dense[i];
+            next += 57 + ((seed = seed * 1103515245u + 12345u) >> 16) % 7;
+        }
+    }
+
+    failed = bench_Stream("1 Hz", dense, count, buffer);
+    failed |= bench_Stream("heartbeat", sparse, sparse_count, buffer);
+    free(dense);
+    free(sparse);
+    free(buffer);
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t block[65535];
+    SampleDecoder_c decoder;
+    codec_sample_t sample;
+    uint8_t header[2];
+    uint32_t blocks = 0;
+    uint32_t samples = 0;
+    FILE *in;
+
+    if ((argc >= 2) && (strcmp(argv[1], "--bench") == 0))
+    {
+        return bench((argc > 2) ? (uint32_t)atoi(argv[2]) : 1000000);
+    }
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <capture.bin> | --bench [samples]\n", argv[0]);
+        return 2;
+    }
+    in = fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    printf("timestamp,temperature_code,humidity_code,temperature,humidity\n");
+    while (fread(header, 1, 2, in) == 2)
+    {
+        uint16_t length = (uint16_t)(header[0] | (header[1] << 8));
+        uint16_t pos = 0;
+        uint16_t used;
+
+        if (fread(block, 1, length, in) != length)
+        {
+            fprintf(stderr, "block %u truncated\n", (unsigned)blocks);
+            break;
+        }
+
+        decoder.Reset();
+        while ((pos < length) && decoder.decode(&block[pos], length - pos, &used, &sample))
+        {
+            printf("%u,%u,%u,%.3f,%.3f\n", (unsigned)sample.timestamp, sample.temperature, sample.humidity,
+                   sample.temperature * (165.0 / 65536.0) - 40.0, sample.humidity * (100.0 / 65536.0));
+            pos += used;
+            samples++;
+        }
+        if (pos != length)
+        {
+            fprintf(stderr, "block %u corrupt at byte %u\n", (unsigned)blocks, pos);
+        }
+        blocks++;
+    }
+
+    fclose(in);
+    fprintf(stderr, "%u blocks, %u samples\n", (unsigned)blocks, (unsigned)samples);
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host cost of Scheduler_c post() and dispatch
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 -DTRACE_ENABLE=0 -I../HostHal -I../../STM32CubeIDE/Core/Inc SchedulerBench.cpp \
+ *	    ../../STM32CubeIDE/Core/Src/Scheduler.cpp -o SchedulerBench
+ *
+ * Usage
+ *
+ *	./SchedulerBench [pairs]
+ *
+ * Scheduler.cpp runs unchanged against Tools/HostHal : PRIMASK is a no-op and DWT->CYCCNT reads the TSC
+ * (x86) or CLOCK_MONOTONIC in ns elsewhere, SystemCoreClock is calibrated to that counter. The ms clock is
+ * a plain variable like the SysTick count of HAL_GetTick().
+ *
+ *	pair        ns per post() + run_Once() of one event, best of 5 runs
+ *	latency     post() to handler entry in counter ticks, median and 99th percentile
+ *
+ * The target figure is read on the board from get_Statistics(), this one only tracks the cost of the
+ * code path between changes. Checked : every post is dispatched once, a post to a pending event merges,
+ * priorities dispatch highest first. Exit code is 0 when every check passed.
+ */
+
+#include <Scheduler.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define BENCH_RUNS            5
+
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = 1000000000U;
+
+static uint32_t entry_stamp;
+static uint32_t order[4];
+static uint32_t order_count;
+
+static double now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+uint32_t host_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    return (uint32_t)now_ns();
+#endif
+}
+
+/*  HAL_GetTick() on the target is a variable read, a clock_gettime() here would dominate the pair  */
+static volatile uint32_t tick_ms;
+
+static uint32_t clock_Ms(void)
+{
+    return tick_ms;
+}
+
+static void task_Empty(void)
+{
+}
+
+static void task_Stamp(void)
+{
+    entry_stamp = host_Cycles();
+}
+
+static void task_Low(void)
+{
+    order[order_count++ & 3] = 2;
+}
+
+static void task_High(void)
+{
+    order[order_count++ & 3] = 0;
+}
+
+static void task_Mid(void)
+{
+    order[order_count++ & 3] = 1;
+}
+
+static void calibrate()
+{
+    double start = now_ns();
+    uint32_t cycles = host_Cycles();
+
+    while (now_ns() - start < 2e7)
+    {
+    }
+    SystemCoreClock = (uint32_t)((host_Cycles() - cycles) / (now_ns() - start) * 1e9);
+}
+
+int main(int argc, char **argv)
+{
+    Scheduler_c sched;
+    uint32_t pairs = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1000000;
+    uint32_t *latency = (uint32_t *)malloc(pairs * sizeof(uint32_t));
+    uint8_t ev_empty, ev_stamp, ev_low, ev_high, ev_mid;
+    double best = 1e30;
+    int failed = 0;
+
+    calibrate();
+    sched.Init(clock_Ms, NULL);
+    ev_empty = sched.add_Event(task_Empty, 0);
+    ev_stamp = sched.add_Event(task_Stamp, 0);
+    ev_low = sched.add_Event(task_Low, 3);
+    ev_high = sched.add_Event(task_High, 0);
+    ev_mid = sched.add_Event(task_Mid, 1);
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        double start = now_ns();
+
+        for (uint32_t i = 0; i < pairs; i++)
+        {
+            sched.post(ev_empty);
+            sched.run_Once();
+        }
+
+        double ns = (now_ns() - start) / pairs;
+        best = (ns < best) ? ns : best;
+    }
+    failed |= (sched.get_Statistics(ev_empty).posts != BENCH_RUNS * pairs)
+              || (sched.get_Statistics(ev_empty).dispatches != BENCH_RUNS * pairs);
+
+    for (uint32_t i = 0; i < pairs; i++)
+    {
+        uint32_t posted = host_Cycles();
+
+        sched.post(ev_stamp);
+        sched.run_Once();
+        latency[i] = entry_stamp - posted;
+    }
+    std::sort(latency, latency + pairs);
+
+    sched.post(ev_low);
+    sched.post(ev_mid);
+    sched.post(ev_low);
+    sched.post(ev_high);
+    while (sched.run_Once())
+    {
+    }
+    failed |= (order_count != 3) || (order[0] != 0) || (order[1] != 1) || (order[2] != 2);
+    failed |= (sched.get_Statistics(ev_low).posts != 2) || (sched.get_Statistics(ev_low).dispatches != 1);
+
+    printf("counter      %.3f GHz\n", SystemCoreClock / 1e9);
+    printf("pair         %5.1f ns  post() + run_Once()\n", best);
+    printf("latency      %5u ticks median, %u ticks 99th percentile, worst %u us in get_Statistics()\n",
+           latency[pairs / 2], latency[pairs - pairs / 100 - 1], sched.get_Statistics(ev_stamp).worst_latency);
+    printf("%s\n", failed ? "FAILED" : "passed");
+    free(latency);
+    return failed;
+}
@@ -0,0 +1,436 @@
+/*
+ @
+ @   Date               :        19.10.2026 / Monday
+ @
+ @   Contact            :        M.Rasit KIYAK                    mrstkyk@gmail.com
+ @
+ @   License            :        GNU AFFERO GENERAL PUBLIC LICENSE v3
+ @
+ @   Description        :        Host decoder for the Trace_c ITM/SWO stream : timeline and latency statistics
+ @
+ @   Version            :        1.0.0
+ */
+
+/*
+ * Build (Linux)
+ *
+ *	g++ -O2 TraceDecoder.cpp -o TraceDecoder
+ *
+ * Usage
+ *
+ *	./TraceDecoder capture.bin [core_hz]			CSV timeline on stdout, statistics on stderr
+ *	./TraceDecoder --selftest					Decodes generated packet streams and checks the result
+ *
+ * The capture is the raw SWO byte stream (NRZ, TRACE_SWO_BAUD, no TPIU formatter), e.g. from
+ * "openocd -c 'itm ports on' -c 'tpiu config internal capture.bin uart off 80000000 1000000'" or any
+ * UART adapter on PB3. Timestamps are ITM local timestamps in core cycles, converted to microseconds with
+ * core_hz (default 80 MHz) until the first TRACE_CLOCK event, then with the frequency it reports.
+ *
+ * Packets handled : synchronization, overflow, local timestamp (both formats), global timestamp and
+ * extension packets (skipped), software source packets (1, 2 or 4 bytes). A local timestamp follows
+ * the events it belongs to, the events between two timestamps share the later one.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define TRACE_CLOCK           1
+#define TRACE_I2C_START       2
+#define TRACE_I2C_END         3
+#define TRACE_BUS_PUSH        4
+#define TRACE_BUS_START       5
+#define TRACE_BUS_DONE        6
+#define TRACE_DRDY            7
+#define TRACE_SAMPLE          8
+#define TRACE_SCHED_POST      9
+#define TRACE_SCHED_RUN       10
+#define TRACE_USER            16
+#define TRACE_PORTS           32
+
+typedef struct
+{
+    uint8_t port;
+    uint32_t value;
+    uint64_t cycles;                  /*  Core cycles since the start of the capture                 */
+    double us;                        /*  Microseconds since the start of the capture                */
+} event_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t from;
+    uint8_t to;
+    uint32_t count;
+    double min;
+    double max;
+    double total;
+} latency_t;
+
+typedef struct
+{
+    uint32_t packets;
+    uint32_t overflows;
+    uint32_t syncs;
+    uint32_t skipped;                 /*  Global timestamp, extension and hardware source packets    */
+    uint32_t errors;                  /*  Truncated or malformed packets                             */
+} counters_t;
+
+static const char *names[TRACE_PORTS] =
+{
+    "port0", "CLOCK", "I2C_START", "I2C_END", "BUS_PUSH", "BUS_START", "BUS_DONE", "DRDY",
+    "SAMPLE", "SCHED_POST", "SCHED_RUN",
+};
+
+/**
+ * @brief  Decode ITM Stream
+ * @note   Events waiting for their timestamp are flushed with the last known time at the end
+ * 		or after an overflow, where the timestamp that follows may have been lost
+ * @param  const uint8_t *data
+ * @param  size_t size
+ * @param  double core_hz	:	Frequency until the first TRACE_CLOCK event
+ * @param  std::vector<event_t> &events
+ * @param  counters_t &counters
+ * @retval None
+ */
+static void decode(const uint8_t *data, size_t size, double core_hz, std::vector<event_t> &events,
+                   counters_t &counters)
+{
+    uint64_t cycles = 0;
+    double us = 0;
+    size_t waiting = events.size();
+    size_t pos = 0;
+    uint32_t zeros = 0;
+
+    while (pos < size)
+    {
+        uint8_t header = data[pos++];
+
+        if (header == 0x00)
+        {
+            zeros++;
+            continue;
+        }
+        if ((header == 0x80) && (zeros >= 5))
+        {
+            counters.syncs++;
+            zeros = 0;
+            continue;
+        }
+        zeros = 0;
+        counters.packets++;
+
+        if (header == 0x70)
+        {
+            counters.overflows++;
+            waiting = events.size();
+            continue;
+        }
+
+        if ((header & 0x0F) == 0x00)
+        {
+            /*  Local timestamp, format 2 (0TTT0000) or format 1 (1CDD0000) with up to 4 continuation bytes  */
+            uint32_t delta = 0;
+
+            if ((header & 0x80) == 0)
+            {
+                delta = (header >> 4) & 0x07;
+            }
+            else
+            {
+                uint8_t shift = 0;
+                uint8_t byte;
+
+                do
+                {
+                    if ((pos >= size) || (shift > 21))
+                    {
+                        counters.errors++;
+                        return;
+                    }
+                    byte = data[pos++];
+                    delta |= (uint32_t)(byte & 0x7F) << shift;
+                    shift += 7;
+                } while (byte & 0x80);
+            }
+
+            cycles += delta;
+            us += delta * 1e6 / core_hz;
+            for (; waiting < events.size(); waiting++)
+            {
+                events[waiting].cycles = cycles;
+                events[waiting].us = us;
+                if ((events[waiting].port == TRACE_CLOCK) && events[waiting].value)
+                {
+                    core_hz = events[waiting].value;
+                }
+            }
+            continue;
+        }
+
+        if (((header & 0x03) == 0x00) || ((header & 0x0B) == 0x08))
+        {
+            /*  Global timestamp (0x94, 0xB4) or extension : continuation bit 7 on every byte  */
+            counters.skipped++;
+            if (header & 0x80)
+            {
+                while ((pos < size) && (data[pos++] & 0x80))
+                {
+                }
+            }
+            continue;
+        }
+
+        /*  Source packet, SS = 1 / 2 / 3 for 1 / 2 / 4 bytes, bit 2 = hardware source  */
+        size_t length = ((header & 0x03) == 3) ? 4 : (header & 0x03);
+
+        if (pos + length > size)
+        {
+            counters.errors++;
+            return;
+        }
+        if (header & 0x04)
+        {
+            counters.skipped++;
+            pos += length;
+            continue;
+        }
+
+        event_t event = {};
+
+        event.port = header >> 3;
+        for (size_t i = 0; i < length; i++)
+        {
+            event.value |= (uint32_t)data[pos + i] << (8 * i);
+        }
+        pos += length;
+        event.cycles = cycles;
+        event.us = us;
+        events.push_back(event);
+    }
+}
+
+/**
+ * @brief  Collect Latency Statistics
+ * @note   Pairs every "to" event with the oldest unmatched "from" event, extra "to" events are ignored
+ * @param  const std::vector<event_t> &events
+ * @param  latency_t &latency
+ * @retval None
+ */
+static void collect(const std::vector<event_t> &events, latency_t &latency)
+{
+    std::vector<double> open;
+
+    latency.count = 0;
+    latency.total = 0;
+    for (const event_t &event : events)
+    {
+        if (event.port == latency.from)
+        {
+            open.push_back(event.us);
+        }
+        else if ((event.port == latency.to) && !open.empty())
+        {
+            double value = event.us - open.front();
+
+            open.erase(open.begin());
+            if ((latency.count == 0) || (value < latency.min))
+            {
+                latency.min = value;
+            }
+            if ((latency.count == 0) || (value > latency.max))
+            {
+                latency.max = value;
+            }
+            latency.total += value;
+            latency.count++;
+        }
+    }
+}
+
+static latency_t latencies[] =
+{
+    { "I2C transaction",  TRACE_I2C_START,  TRACE_I2C_END,   0, 0, 0, 0 },
+    { "bus queue wait",   TRACE_BUS_PUSH,   TRACE_BUS_START, 0, 0, 0, 0 },
+    { "bus transfer",     TRACE_BUS_START,  TRACE_BUS_DONE,  0, 0, 0, 0 },
+    { "event dispatch",   TRACE_SCHED_POST, TRACE_SCHED_RUN, 0, 0, 0, 0 },
+    { "DRDY to sample",   TRACE_DRDY,       TRACE_SAMPLE,    0, 0, 0, 0 },
+};
+
+/*  Self test : encoder for the packets the ITM emits  */
+
+static void put_Source(std::vector<uint8_t> &out, uint8_t port, uint32_t value, uint8_t bytes)
+{
+    out.push_back((uint8_t)((port << 3) | ((bytes == 4) ? 3 : bytes)));
+    for (uint8_t i = 0; i < bytes; i++)
+    {
+        out.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+static void put_Timestamp(std::vector<uint8_t> &out, uint32_t delta)
+{
+    if ((delta != 0) && (delta < 7))                           /*  Format 2, 0x00 would read as sync  */
+    {
+        out.push_back((uint8_t)(delta << 4));
+        return;
+    }
+    out.push_back(0xC0);
+    while (1)
+    {
+        uint8_t byte = delta & 0x7F;
+
+        delta >>= 7;
+        out.push_back(delta ? (byte | 0x80) : byte);
+        if (delta == 0)
+        {
+            break;
+        }
+    }
+}
+
+static int check(int condition, const char *what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "FAIL : %s\n", what);
+    }
+    return condition ? 0 : 1;
+}
+
+/**
+ * @brief  Self Test
+ * @note   One stream with sync, a clock change, a burst of events sharing one timestamp, both timestamp
+ * 		formats, skipped packets, an overflow and a truncated tail
+ * @param  None
+ * @retval int	:	0 = pass
+ */
+static int selftest()
+{
+    std::vector<uint8_t> stream = { 0, 0, 0, 0, 0, 0x80 };
+    std::vector<event_t> events;
+    counters_t counters = {};
+    latency_t i2c = latencies[0];
+    latency_t wait = latencies[1];
+    int failed = 0;
+
+    put_Source(stream, TRACE_CLOCK, 2000000, 4);                /*  2 MHz : 1 cycle = 0.5 us  */
+    put_Timestamp(stream, 0);
+    put_Source(stream, TRACE_BUS_PUSH, 0x00018000, 4);
+    put_Source(stream, TRACE_BUS_START, 0x00028000, 4);
+    put_Timestamp(stream, 3);                                   /*  Format 2, shared by push and start  */
+    put_Source(stream, TRACE_BUS_DONE, 1, 1);
+    put_Timestamp(stream, 200);                                 /*  Format 1, two bytes  */
+    stream.push_back(0x94);                                     /*  Global timestamp 1  */
+    stream.push_back(0x81);
+    stream.push_back(0x01);
+    stream.push_back(0x08);                                     /*  Extension, one byte  */
+    put_Source(stream, TRACE_CLOCK, 80000000, 4);               /*  80 MHz from the next timestamp  */
+    put_Timestamp(stream, 400);
+    put_Source(stream, TRACE_I2C_START, 0x000002, 4);
+    put_Timestamp(stream, 400);                                 /*  5 us  */
+    put_Source(stream, TRACE_I2C_END, 0, 2);
+    put_Timestamp(stream, 8000);                                /*  100 us  */
+    put_Source(stream, TRACE_I2C_START, 0x000004, 4);
+    put_Timestamp(stream, 100000);                              /*  Format 1, three bytes  */
+    stream.push_back(0x70);                                     /*  Overflow  */
+    put_Source(stream, TRACE_I2C_END, 0, 2);
+    put_Timestamp(stream, 16000);                               /*  200 us  */
+    stream.push_back((uint8_t)((TRACE_USER << 3) | 3));    /*  Truncated  */
+    stream.push_back(0x01);
+
+    decode(stream.data(), stream.size(), 80000000.0, events, counters);
+
+    failed += check(events.size() == 9, "event count");
+    failed += check(counters.syncs == 1, "sync");
+    failed += check(counters.overflows == 1, "overflow");
+    failed += check(counters.skipped == 2, "skipped packets");
+    failed += check(counters.errors == 1, "truncated tail");
+    if (events.size() == 9)
+    {
+        failed += check((events[1].port == TRACE_BUS_PUSH) && (events[1].value == 0x00018000), "push value");
+        failed += check((events[1].cycles == 3) && (events[2].cycles == 3), "shared timestamp, format 2");
+        failed += check((events[3].cycles == 203) && (events[3].us == 101.5), "format 1 at 2 MHz");
+        failed += check((events[4].port == TRACE_CLOCK) && (events[4].us == 301.5), "clock change");
+        failed += check(events[5].us - events[4].us == 5.0, "80 MHz after TRACE_CLOCK");
+        failed += check(events[6].us - events[5].us == 100.0, "I2C end");
+        failed += check(events[7].cycles == events[6].cycles + 100000, "three byte timestamp");
+        failed += check(events[8].cycles == events[7].cycles + 16000, "event after overflow");
+    }
+
+    collect(events, i2c);
+    collect(events, wait);
+    failed += check((i2c.count == 2) && (i2c.min == 100.0) && (i2c.max == 200.0), "I2C latency");
+    failed += check((wait.count == 1) && (wait.max == 0.0), "queue wait latency");
+
+    fprintf(stderr, "selftest %s\n", failed ? "FAILED" : "passed");
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<uint8_t> data;
+    std::vector<event_t> events;
+    counters_t counters = {};
+    double core_hz = 80000000.0;
+    FILE *in;
+    int c;
+
+    if ((argc == 2) && (strcmp(argv[1], "--selftest") == 0))
+    {
+        return selftest();
+    }
+    if ((argc != 2) && (argc != 3))
+    {
+        fprintf(stderr, "usage: %s <capture.bin> [core_hz] | --selftest\n", argv[0]);
+        return 2;
+    }
+    if (argc == 3)
+    {
+        core_hz = atof(argv[2]);
+    }
+    in = fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    while ((c = fgetc(in)) != EOF)
+    {
+        data.push_back((uint8_t)c);
+    }
+    fclose(in);
+
+    decode(data.data(), data.size(), core_hz, events, counters);
+
+    printf("us,cycles,event,value\n");
+    for (const event_t &event : events)
+    {
+        if (names[event.port])
+        {
+            printf("%.3f,%llu,%s,0x%08X\n", event.us, (unsigned long long)event.cycles, names[event.port],
+                   (unsigned)event.value);
+        }
+        else
+        {
+            printf("%.3f,%llu,USER%u,0x%08X\n", event.us, (unsigned long long)event.cycles,
+                   (unsigned)event.port, (unsigned)event.value);
+        }
+    }
+
+    fprintf(stderr, "%u packets, %u events, %u overflows, %u skipped, %u errors\n", (unsigned)counters.packets,
+            (unsigned)events.size(), (unsigned)counters.overflows, (unsigned)counters.skipped,
+            (unsigned)counters.errors);
+    for (latency_t &latency : latencies)
+    {
+        collect(events, latency);
+        if (latency.count)
+        {
+            fprintf(stderr, "%-16s n=%-6u min %10.2f us  avg %10.2f us  max %10.2f us\n", latency.name,
+                    (unsigned)latency.count, latency.min, latency.total / latency.count, latency.max);
+        }
+    }
+    return 0;
+}